@@ -0,0 +1,179 @@
+#include "problems.h"
+#include "utils.h"
+
+#include <benchmark/benchmark.h>
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <utility>
+#include <vector>
+
+using namespace clarabel;
+using namespace Eigen;
+using problems::Problem;
+
+static DefaultSettings<double> bench_settings()
+{
+    DefaultSettings<double> settings = DefaultSettings<double>::default_settings();
+    settings.verbose = false;
+    return settings;
+}
+
+// Solver construction: equilibration, KKT assembly and factorisation
+template<Problem (*Generate)(int, unsigned)>
+static void BM_Setup(benchmark::State &state)
+{
+    Problem prob = Generate(static_cast<int>(state.range(0)), 1);
+    DefaultSettings<double> settings = bench_settings();
+    utils::LatencyRecorder latency(state);
+
+    for (auto _ : state)
+    {
+        latency.time([&]() {
+            DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, settings);
+            benchmark::DoNotOptimize(solver);
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Repeated solve of a set up solver.  Reports throughput in problems/s and
+// the time per interior point iteration.
+template<Problem (*Generate)(int, unsigned)>
+static void BM_Solve(benchmark::State &state)
+{
+    Problem prob = Generate(static_cast<int>(state.range(0)), 1);
+    DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, bench_settings());
+    utils::LatencyRecorder latency(state);
+
+    uint64_t ip_iterations = 0;
+    for (auto _ : state)
+    {
+        latency.time([&]() { solver.solve(); });
+        ip_iterations += solver.info().iterations;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ip_iters"] = benchmark::Counter(
+        static_cast<double>(ip_iterations), benchmark::Counter::kAvgIterations);
+    state.counters["s_per_ip_iter"] = benchmark::Counter(
+        static_cast<double>(ip_iterations), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+#define CLARABEL_BENCH_FAMILY(NAME, GENERATOR, ...)                                                 \
+    BENCHMARK_TEMPLATE(BM_Setup, GENERATOR)->Name("Setup/" NAME)->__VA_ARGS__->UseManualTime();     \
+    BENCHMARK_TEMPLATE(BM_Solve, GENERATOR)->Name("Solve/" NAME)->__VA_ARGS__->UseManualTime();
+
+CLARABEL_BENCH_FAMILY("LP", problems::lp, Arg(10)->Arg(100)->Arg(1000)->Arg(10000))
+CLARABEL_BENCH_FAMILY("QP", problems::qp, Arg(10)->Arg(100)->Arg(1000)->Arg(10000))
+CLARABEL_BENCH_FAMILY("SOCP", problems::socp, Arg(10)->Arg(100)->Arg(1000))
+CLARABEL_BENCH_FAMILY("ExpCone", problems::expcone, Arg(10)->Arg(100)->Arg(1000))
+CLARABEL_BENCH_FAMILY("PowCone", problems::powcone, Arg(10)->Arg(100)->Arg(1000))
+#ifdef FEATURE_SDP
+CLARABEL_BENCH_FAMILY("SDP", problems::sdp, Arg(5)->Arg(10)->Arg(20)->Arg(40))
+#endif
+
+// Solver construction with settings converted and validated once up front
+static void BM_SetupSettingsHandle(benchmark::State &state)
+{
+    Problem prob = problems::qp(static_cast<int>(state.range(0)), 1);
+    DefaultSettingsHandle<double> settings(bench_settings());
+    utils::LatencyRecorder latency(state);
+
+    for (auto _ : state)
+    {
+        latency.time([&]() {
+            DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, settings);
+            benchmark::DoNotOptimize(solver);
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SetupSettingsHandle)->Name("Setup/QP_settings_handle")->Arg(10)->Arg(100)->UseManualTime();
+
+// Solver construction through a pool, recycling the solver released by the previous iteration
+static void BM_SetupPooled(benchmark::State &state)
+{
+    Problem prob = problems::qp(static_cast<int>(state.range(0)), 1);
+    SolverPool<double> pool(bench_settings());
+    pool.release(pool.acquire(prob.P, prob.q, prob.A, prob.b, prob.cones));
+    utils::LatencyRecorder latency(state);
+
+    for (auto _ : state)
+    {
+        latency.time([&]() {
+            DefaultSolver<double> solver = pool.acquire(prob.P, prob.q, prob.A, prob.b, prob.cones);
+            benchmark::DoNotOptimize(solver);
+            pool.release(std::move(solver));
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SetupPooled)->Name("Setup/QP_pooled")->Arg(10)->Arg(100)->Arg(1000)->UseManualTime();
+
+// FFI overhead of reading results back from the solver
+static void BM_Info(benchmark::State &state)
+{
+    Problem prob = problems::qp(static_cast<int>(state.range(0)));
+    DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, bench_settings());
+    solver.solve();
+
+    for (auto _ : state)
+    {
+        DefaultInfo<double> info = solver.info();
+        benchmark::DoNotOptimize(info);
+    }
+}
+BENCHMARK(BM_Info)->Name("FFI/info")->Arg(100);
+
+static void BM_Solution(benchmark::State &state)
+{
+    Problem prob = problems::qp(static_cast<int>(state.range(0)));
+    DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, bench_settings());
+    solver.solve();
+
+    VectorXd x(prob.P.cols());
+    for (auto _ : state)
+    {
+        DefaultSolution<double> solution = solver.solution();
+        x = solution.x;
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(BM_Solution)->Name("FFI/solution")->Arg(100)->Arg(10000);
+
+static void BM_SolutionInto(benchmark::State &state)
+{
+    Problem prob = problems::qp(static_cast<int>(state.range(0)));
+    DefaultSolver<double> solver(prob.P, prob.q, prob.A, prob.b, prob.cones, bench_settings());
+    solver.solve();
+
+    VectorXd x(prob.P.cols());
+    for (auto _ : state)
+    {
+        solver.solution_into(x);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(BM_SolutionInto)->Name("FFI/solution_into")->Arg(100)->Arg(10000);
+
+// Many small independent problems through the batch interface
+static void BM_BatchSolve(benchmark::State &state)
+{
+    const size_t n_problems = 256;
+    Problem prob = problems::qp(static_cast<int>(state.range(0)));
+
+    std::vector<DefaultSolver<double>> solvers;
+    solvers.reserve(n_problems);
+    for (size_t k = 0; k < n_problems; ++k)
+    {
+        solvers.emplace_back(prob.P, prob.q, prob.A, prob.b, prob.cones, bench_settings());
+    }
+
+    BatchSolver<double> batch(static_cast<uintptr_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        std::vector<DefaultInfo<double>> info = batch.solve(solvers);
+        benchmark::DoNotOptimize(info.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n_problems);
+}
+BENCHMARK(BM_BatchSolve)->Name("Batch/QP")->ArgsProduct({ { 10, 100 }, { 1, 2, 4, 0 } })->UseRealTime();
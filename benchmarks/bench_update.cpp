@@ -0,0 +1,177 @@
+#include "problems.h"
+#include "utils.h"
+
+#include <benchmark/benchmark.h>
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace clarabel;
+using namespace Eigen;
+using problems::Problem;
+
+// Data for benchmarking every update_* overload of DefaultSolver on a QP.  The
+// new values are small perturbations so that re-solves stay representative.
+struct UpdateData
+{
+    Problem prob;
+    DefaultSolver<double> solver;
+
+    SparseMatrix<double> P2, A2;
+    SparseMatrix<double, ColMajor, int64_t> P2_int64, A2_int64;
+    VectorXd Pnzval, Anzval, q2, b2;
+
+    // every tenth entry, for the partial forms
+    VectorX<uintptr_t> P_index, A_index, q_index, b_index;
+    VectorX<int32_t> P_index32, A_index32, q_index32, b_index32;
+    VectorXd P_values, A_values, q_values, b_values;
+
+    static DefaultSettings<double> settings()
+    {
+        DefaultSettings<double> settings = DefaultSettings<double>::default_settings();
+        settings.verbose = false;
+        settings.presolve_enable = false;
+        return settings;
+    }
+
+    static void every_tenth(const VectorXd &src, VectorX<uintptr_t> &index, VectorXd &values)
+    {
+        Index n = (src.size() + 9) / 10;
+        index.resize(n);
+        values.resize(n);
+        for (Index k = 0; k < n; ++k)
+        {
+            index[k] = static_cast<uintptr_t>(10 * k);
+            values[k] = src[10 * k];
+        }
+    }
+
+    explicit UpdateData(int n)
+        : prob(problems::qp(n)),
+          solver(prob.P, prob.q, prob.A, prob.b, prob.cones, settings())
+    {
+        P2 = prob.P;
+        A2 = prob.A;
+        for (Index k = 0; k < P2.nonZeros(); ++k)
+        {
+            P2.valuePtr()[k] *= 1.001;
+        }
+        for (Index k = 0; k < A2.nonZeros(); ++k)
+        {
+            A2.valuePtr()[k] *= 1.001;
+        }
+        P2_int64 = P2;
+        P2_int64.makeCompressed();
+        A2_int64 = A2;
+        A2_int64.makeCompressed();
+
+        Pnzval = Map<VectorXd>(P2.valuePtr(), P2.nonZeros());
+        Anzval = Map<VectorXd>(A2.valuePtr(), A2.nonZeros());
+        q2 = prob.q * 1.001;
+        b2 = prob.b * 1.001;
+
+        every_tenth(Pnzval, P_index, P_values);
+        every_tenth(Anzval, A_index, A_values);
+        every_tenth(q2, q_index, q_values);
+        every_tenth(b2, b_index, b_values);
+        P_index32 = P_index.cast<int32_t>();
+        A_index32 = A_index.cast<int32_t>();
+        q_index32 = q_index.cast<int32_t>();
+        b_index32 = b_index.cast<int32_t>();
+
+        solver.solve();
+    }
+};
+
+using UpdateFn = std::function<void(UpdateData &)>;
+
+// Cost of the update call alone
+static void BM_Update(benchmark::State &state, const UpdateFn &update)
+{
+    UpdateData data(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        update(data);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Latency of an update followed by a re-solve
+static void BM_Resolve(benchmark::State &state, const UpdateFn &update)
+{
+    UpdateData data(static_cast<int>(state.range(0)));
+    utils::LatencyRecorder latency(state);
+    for (auto _ : state)
+    {
+        latency.time([&]() {
+            update(data);
+            data.solver.solve();
+        });
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static int register_update_benchmarks()
+{
+    const std::vector<std::pair<std::string, UpdateFn>> overloads = {
+        { "P/csc", [](UpdateData &d) { d.solver.update_P(d.P2); } },
+        { "P/csc_int64", [](UpdateData &d) { d.solver.update_P(d.P2_int64); } },
+        { "P/eigen", [](UpdateData &d) { d.solver.update_P(d.Pnzval); } },
+        { "P/ptr", [](UpdateData &d) { d.solver.update_P(d.Pnzval.data(), d.Pnzval.size()); } },
+        { "P/partial_eigen", [](UpdateData &d) { d.solver.update_P(d.P_index, d.P_values); } },
+        { "P/partial_ptr", [](UpdateData &d) { d.solver.update_P(d.P_index.data(), d.P_values.data(), d.P_index.size()); } },
+        { "P/sorted_ptr", [](UpdateData &d) { d.solver.update_P_sorted(d.P_index.data(), d.P_values.data(), d.P_index.size()); } },
+        { "P/sorted_i32", [](UpdateData &d) { d.solver.update_P_sorted(d.P_index32.data(), d.P_values.data(), d.P_index32.size()); } },
+
+        { "A/csc", [](UpdateData &d) { d.solver.update_A(d.A2); } },
+        { "A/csc_int64", [](UpdateData &d) { d.solver.update_A(d.A2_int64); } },
+        { "A/eigen", [](UpdateData &d) { d.solver.update_A(d.Anzval); } },
+        { "A/ptr", [](UpdateData &d) { d.solver.update_A(d.Anzval.data(), d.Anzval.size()); } },
+        { "A/partial_eigen", [](UpdateData &d) { d.solver.update_A(d.A_index, d.A_values); } },
+        { "A/partial_ptr", [](UpdateData &d) { d.solver.update_A(d.A_index.data(), d.A_values.data(), d.A_index.size()); } },
+        { "A/sorted_ptr", [](UpdateData &d) { d.solver.update_A_sorted(d.A_index.data(), d.A_values.data(), d.A_index.size()); } },
+        { "A/sorted_i32", [](UpdateData &d) { d.solver.update_A_sorted(d.A_index32.data(), d.A_values.data(), d.A_index32.size()); } },
+
+        { "q/eigen", [](UpdateData &d) { d.solver.update_q(d.q2); } },
+        { "q/ptr", [](UpdateData &d) { d.solver.update_q(d.q2.data(), d.q2.size()); } },
+        { "q/partial_eigen", [](UpdateData &d) { d.solver.update_q(d.q_index, d.q_values); } },
+        { "q/partial_ptr", [](UpdateData &d) { d.solver.update_q(d.q_index.data(), d.q_values.data(), d.q_index.size()); } },
+        { "q/sorted_ptr", [](UpdateData &d) { d.solver.update_q_sorted(d.q_index.data(), d.q_values.data(), d.q_index.size()); } },
+        { "q/sorted_i32", [](UpdateData &d) { d.solver.update_q_sorted(d.q_index32.data(), d.q_values.data(), d.q_index32.size()); } },
+
+        { "b/eigen", [](UpdateData &d) { d.solver.update_b(d.b2); } },
+        { "b/ptr", [](UpdateData &d) { d.solver.update_b(d.b2.data(), d.b2.size()); } },
+        { "b/partial_eigen", [](UpdateData &d) { d.solver.update_b(d.b_index, d.b_values); } },
+        { "b/partial_ptr", [](UpdateData &d) { d.solver.update_b(d.b_index.data(), d.b_values.data(), d.b_index.size()); } },
+        { "b/sorted_ptr", [](UpdateData &d) { d.solver.update_b_sorted(d.b_index.data(), d.b_values.data(), d.b_index.size()); } },
+        { "b/sorted_i32", [](UpdateData &d) { d.solver.update_b_sorted(d.b_index32.data(), d.b_values.data(), d.b_index32.size()); } },
+
+        { "all/separate", [](UpdateData &d) {
+              d.solver.update_P(d.Pnzval);
+              d.solver.update_q(d.q2);
+              d.solver.update_A(d.Anzval);
+              d.solver.update_b(d.b2);
+          } },
+        { "all/update_data", [](UpdateData &d) { d.solver.update_data(d.Pnzval, d.q2, d.Anzval, d.b2); } },
+    };
+
+    for (const auto &overload : overloads)
+    {
+        const UpdateFn &update = overload.second;
+        benchmark::RegisterBenchmark(("Update/" + overload.first).c_str(),
+                                     [update](benchmark::State &state) { BM_Update(state, update); })
+            ->Arg(100)
+            ->Arg(10000);
+        benchmark::RegisterBenchmark(("Resolve/" + overload.first).c_str(),
+                                     [update](benchmark::State &state) { BM_Resolve(state, update); })
+            ->Arg(100)
+            ->Arg(1000)
+            ->UseManualTime();
+    }
+    return 0;
+}
+
+static int update_benchmarks_registered = register_update_benchmarks();
@@ -0,0 +1,248 @@
+#ifndef PROBLEMS_H
+#define PROBLEMS_H
+
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Generators for the benchmark problem families.  Every problem is feasible and
+// bounded for all sizes, and is generated from a fixed seed so that runs are
+// comparable.
+
+namespace problems
+{
+    using namespace clarabel;
+    using namespace Eigen;
+
+    struct Problem
+    {
+        SparseMatrix<double> P, A;
+        VectorXd q, b;
+        std::vector<SupportedConeT<double>> cones;
+    };
+
+    // Random sparse m x n matrix with about `density` nonzeros per column
+    inline SparseMatrix<double> random_sparse(int m, int n, int density, std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<int> row(0, m - 1);
+        std::normal_distribution<double> val(0., 1.);
+
+        std::vector<Triplet<double>> triplets;
+        triplets.reserve(static_cast<size_t>(n) * density);
+        for (int j = 0; j < n; ++j)
+        {
+            for (int k = 0; k < density; ++k)
+            {
+                triplets.emplace_back(row(rng), j, val(rng));
+            }
+        }
+        SparseMatrix<double> M(m, n);
+        M.setFromTriplets(triplets.begin(), triplets.end());
+        M.makeCompressed();
+        return M;
+    }
+
+    inline SparseMatrix<double> identity(int n, double scale = 1.)
+    {
+        SparseMatrix<double> I(n, n);
+        I.setIdentity();
+        I *= scale;
+        I.makeCompressed();
+        return I;
+    }
+
+    // Stack sparse matrices with the same number of columns on top of each other
+    inline SparseMatrix<double> vstack(const std::vector<SparseMatrix<double>> &blocks)
+    {
+        int m = 0;
+        int n = blocks.front().cols();
+        std::vector<Triplet<double>> triplets;
+        for (const auto &B : blocks)
+        {
+            for (int j = 0; j < B.outerSize(); ++j)
+            {
+                for (SparseMatrix<double>::InnerIterator it(B, j); it; ++it)
+                {
+                    triplets.emplace_back(m + it.row(), it.col(), it.value());
+                }
+            }
+            m += B.rows();
+        }
+        SparseMatrix<double> M(m, n);
+        M.setFromTriplets(triplets.begin(), triplets.end());
+        M.makeCompressed();
+        return M;
+    }
+
+    // min c'x  s.t.  Gx <= h,  -1 <= x <= 1
+    inline Problem lp(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> unif(0., 1.);
+        int m = 2 * n;
+
+        Problem prob;
+        prob.P = SparseMatrix<double>(n, n);
+        prob.P.makeCompressed();
+        prob.q = VectorXd::NullaryExpr(n, [&]() { return unif(rng) - 0.5; });
+
+        prob.A = vstack({ random_sparse(m, n, 3, rng), identity(n), identity(n, -1.) });
+        prob.b.resize(m + 2 * n);
+        prob.b << VectorXd::NullaryExpr(m, [&]() { return 1. + unif(rng); }), VectorXd::Ones(2 * n);
+
+        prob.cones = { NonnegativeConeT<double>(m + 2 * n) };
+        return prob;
+    }
+
+    // LP constraints with a strictly convex quadratic cost (upper triangle of P)
+    inline Problem qp(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        Problem prob = lp(n, seed);
+
+        SparseMatrix<double> M = random_sparse(n, n, 2, rng);
+        SparseMatrix<double> P = SparseMatrix<double>(M.transpose() * M) + identity(n);
+        prob.P = P.triangularView<Upper>();
+        prob.P.makeCompressed();
+        return prob;
+    }
+
+    // min c'x  s.t.  ||Gx - h|| <= r,  -1 <= x <= 1
+    inline Problem socp(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> unif(0., 1.);
+        int m = n / 2 + 1;
+
+        Problem prob;
+        prob.P = SparseMatrix<double>(n, n);
+        prob.P.makeCompressed();
+        prob.q = VectorXd::NullaryExpr(n, [&]() { return unif(rng) - 0.5; });
+
+        // (r, h - Gx) in SOC  followed by the box
+        SparseMatrix<double> top(1, n);
+        prob.A = vstack({ top, random_sparse(m, n, 2, rng), identity(n), identity(n, -1.) });
+        prob.b.resize(1 + m + 2 * n);
+        prob.b << 1. + m, VectorXd::NullaryExpr(m, [&]() { return unif(rng); }), VectorXd::Ones(2 * n);
+
+        prob.cones = { SecondOrderConeT<double>(1 + m), NonnegativeConeT<double>(2 * n) };
+        return prob;
+    }
+
+    // max sum_k t_k  s.t.  exp(t_k) <= x_k,  x_k <= u_k,  with variables (t, x)
+    inline Problem expcone(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> unif(1., 2.);
+
+        Problem prob;
+        prob.P = SparseMatrix<double>(2 * n, 2 * n);
+        prob.P.makeCompressed();
+        prob.q = VectorXd::Zero(2 * n);
+        prob.q.head(n).setConstant(-1.);
+
+        std::vector<Triplet<double>> triplets;
+        prob.b = VectorXd::Zero(4 * n);
+        for (int k = 0; k < n; ++k)
+        {
+            // (t_k, 1, x_k) in K_exp
+            triplets.emplace_back(3 * k, k, -1.);
+            prob.b[3 * k + 1] = 1.;
+            triplets.emplace_back(3 * k + 2, n + k, -1.);
+            prob.cones.push_back(ExponentialConeT<double>());
+        }
+        for (int k = 0; k < n; ++k)
+        {
+            triplets.emplace_back(3 * n + k, n + k, 1.);
+            prob.b[3 * n + k] = unif(rng);
+        }
+        prob.cones.push_back(NonnegativeConeT<double>(n));
+
+        prob.A = SparseMatrix<double>(4 * n, 2 * n);
+        prob.A.setFromTriplets(triplets.begin(), triplets.end());
+        prob.A.makeCompressed();
+        return prob;
+    }
+
+    // max sum_k z_k  s.t.  (x_k, y_k, z_k) in K_pow(a_k),  x_k + y_k <= 2
+    inline Problem powcone(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> unif(0.1, 0.9);
+
+        Problem prob;
+        prob.P = SparseMatrix<double>(3 * n, 3 * n);
+        prob.P.makeCompressed();
+        prob.q = VectorXd::Zero(3 * n);
+
+        std::vector<Triplet<double>> triplets;
+        prob.b = VectorXd::Zero(4 * n);
+        for (int k = 0; k < n; ++k)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                triplets.emplace_back(3 * k + i, 3 * k + i, -1.);
+            }
+            prob.q[3 * k + 2] = -1.;
+            prob.cones.push_back(PowerConeT<double>(unif(rng)));
+        }
+        for (int k = 0; k < n; ++k)
+        {
+            triplets.emplace_back(3 * n + k, 3 * k, 1.);
+            triplets.emplace_back(3 * n + k, 3 * k + 1, 1.);
+            prob.b[3 * n + k] = 2.;
+        }
+        prob.cones.push_back(NonnegativeConeT<double>(n));
+
+        prob.A = SparseMatrix<double>(4 * n, 3 * n);
+        prob.A.setFromTriplets(triplets.begin(), triplets.end());
+        prob.A.makeCompressed();
+        return prob;
+    }
+
+#ifdef FEATURE_SDP
+    // Smallest eigenvalue of a random symmetric n x n matrix C:
+    // min <C, X>  s.t.  trace(X) = 1,  X psd, with x = svec(X)
+    inline Problem sdp(int n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> val(0., 1.);
+        int nvec = n * (n + 1) / 2;
+        double sqrt2 = std::sqrt(2.);
+
+        Problem prob;
+        prob.P = SparseMatrix<double>(nvec, nvec);
+        prob.P.makeCompressed();
+        prob.q.resize(nvec);
+
+        std::vector<Triplet<double>> triplets;
+        for (int j = 0, k = 0; j < n; ++j)
+        {
+            for (int i = 0; i <= j; ++i, ++k)
+            {
+                // trace row for diagonal entries
+                if (i == j)
+                {
+                    triplets.emplace_back(0, k, 1.);
+                }
+                prob.q[k] = (i == j) ? val(rng) : sqrt2 * val(rng);
+                triplets.emplace_back(1 + k, k, -1.);
+            }
+        }
+        prob.A = SparseMatrix<double>(1 + nvec, nvec);
+        prob.A.setFromTriplets(triplets.begin(), triplets.end());
+        prob.A.makeCompressed();
+
+        prob.b = VectorXd::Zero(1 + nvec);
+        prob.b[0] = 1.;
+
+        prob.cones = { ZeroConeT<double>(1), PSDTriangleConeT<double>(n) };
+        return prob;
+    }
+#endif
+
+} // namespace problems
+
+#endif /* PROBLEMS_H */
@@ -0,0 +1,56 @@
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace utils
+{
+    // Times each benchmark iteration individually and reports latency
+    // percentiles (in microseconds) alongside the usual mean.  Benchmarks
+    // using it must be registered with UseManualTime().
+    class LatencyRecorder
+    {
+      public:
+        explicit LatencyRecorder(benchmark::State &state) : state(state) {}
+
+        ~LatencyRecorder()
+        {
+            if (samples.empty())
+            {
+                return;
+            }
+            std::sort(samples.begin(), samples.end());
+            state.counters["p50_us"] = percentile(0.50);
+            state.counters["p90_us"] = percentile(0.90);
+            state.counters["p99_us"] = percentile(0.99);
+            state.counters["max_us"] = samples.back();
+        }
+
+        template<typename F>
+        void time(F &&f)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            state.SetIterationTime(elapsed.count());
+            samples.push_back(1e6 * elapsed.count());
+        }
+
+      private:
+        benchmark::State &state;
+        std::vector<double> samples;
+
+        double percentile(double p) const
+        {
+            size_t k = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+            return samples[k];
+        }
+    };
+
+}
+
+#endif /* UTILS_H */
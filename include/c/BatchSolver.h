@@ -0,0 +1,49 @@
+#ifndef CLARABEL_BATCH_SOLVER_H
+#define CLARABEL_BATCH_SOLVER_H
+
+#include "ClarabelTypes.h"
+#include "DefaultInfo.h"
+#include "DefaultSolver.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Batch solver APIs
+
+/// @brief Solve a batch of independent solvers in parallel
+///
+/// The solvers are shared out between the calling thread and the library's worker
+/// threads, which also run asynchronous solves, and idle threads pick up the remaining
+/// problems until the batch is complete.  Each solver must appear at most once in the
+/// batch.  NULL entries are skipped.
+///
+/// @param solvers Array of solver pointers (length n_solvers)
+/// @param n_solvers Number of solvers in the batch
+/// @param n_threads Maximum number of threads working on the batch, the caller included.
+/// Use 0 for the global thread count, see clarabel_set_global_thread_pool, which also
+/// bounds the worker threads.
+/// @param info Array of length n_solvers that receives the info for each solver.  May be
+/// NULL.  The entry of a solver whose solve fails internally is left unchanged.
+void clarabel_BatchSolve_f64(ClarabelDefaultSolver_f64 *const *solvers,
+                             uintptr_t n_solvers,
+                             uintptr_t n_threads,
+                             ClarabelDefaultInfo_f64 *info);
+
+void clarabel_BatchSolve_f32(ClarabelDefaultSolver_f32 *const *solvers,
+                             uintptr_t n_solvers,
+                             uintptr_t n_threads,
+                             ClarabelDefaultInfo_f32 *info);
+
+static inline void clarabel_BatchSolve(ClarabelDefaultSolver *const *solvers,
+                                       uintptr_t n_solvers,
+                                       uintptr_t n_threads,
+                                       ClarabelDefaultInfo *info)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_BatchSolve_f32(solvers, n_solvers, n_threads, info);
+#else
+    clarabel_BatchSolve_f64(solvers, n_solvers, n_threads, info);
+#endif
+}
+
+#endif /* CLARABEL_BATCH_SOLVER_H */
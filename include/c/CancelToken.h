@@ -0,0 +1,37 @@
+#ifndef CLARABEL_CANCEL_TOKEN_H
+#define CLARABEL_CANCEL_TOKEN_H
+
+#include <stdbool.h>
+
+// Cancellation token
+//
+// A token holds a cancellation flag and an optional deadline.  Solvers it is attached to
+// with clarabel_DefaultSolver_set_cancel_token poll it at every iteration boundary and
+// stop with status ClarabelCallbackTerminated once it is cancelled or the deadline has
+// passed.  Cancellation is sticky until the token is reset.  A token may be shared by any
+// number of solvers, and every function below may be called from any thread while those
+// solvers are running.
+typedef struct ClarabelCancelToken ClarabelCancelToken;
+
+/// @brief Create a token, neither cancelled nor with a deadline
+ClarabelCancelToken *clarabel_CancelToken_new(void);
+
+/// @brief Release the caller's reference.  Solvers the token is attached to keep their own.
+void clarabel_CancelToken_free(ClarabelCancelToken *token);
+
+/// @brief Stop all solves using the token at their next iteration boundary
+void clarabel_CancelToken_cancel(const ClarabelCancelToken *token);
+
+/// @brief Clear the cancellation flag and the deadline
+void clarabel_CancelToken_reset(const ClarabelCancelToken *token);
+
+/// @brief True once the token has been cancelled or its deadline has passed
+bool clarabel_CancelToken_is_cancelled(const ClarabelCancelToken *token);
+
+/// @brief Set the deadline to the given number of seconds from now, replacing any
+/// earlier deadline.  Zero or negative values expire the token immediately.
+void clarabel_CancelToken_set_deadline(const ClarabelCancelToken *token, double seconds);
+
+void clarabel_CancelToken_clear_deadline(const ClarabelCancelToken *token);
+
+#endif /* CLARABEL_CANCEL_TOKEN_H */
@@ -55,6 +55,32 @@ typedef ClarabelCscMatrix_f32 ClarabelCscMatrix;
 typedef ClarabelCscMatrix_f64 ClarabelCscMatrix;
 #endif
 
+// CSC matrices with 32-bit indices.  The indices are widened once inside the
+// solver, so callers with int32 index arrays need not make a widened copy.
+typedef struct ClarabelCscMatrix_f64_i32
+{
+    uintptr_t m;
+    uintptr_t n;
+    const int32_t *colptr;
+    const int32_t *rowval;
+    const double *nzval;
+} ClarabelCscMatrix_f64_i32;
+
+typedef struct ClarabelCscMatrix_f32_i32
+{
+    uintptr_t m;
+    uintptr_t n;
+    const int32_t *colptr;
+    const int32_t *rowval;
+    const float *nzval;
+} ClarabelCscMatrix_f32_i32;
+
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelCscMatrix_f32_i32 ClarabelCscMatrix_i32;
+#else
+typedef ClarabelCscMatrix_f64_i32 ClarabelCscMatrix_i32;
+#endif
+
 // ClarabelCscMatrix APIs
 
 // ClarabelCscMatrix::init
@@ -92,4 +118,39 @@ static inline void clarabel_CscMatrix_init(ClarabelCscMatrix_f64 *ptr,
 #endif
 }
 
+// ClarabelCscMatrix_i32::init
+void clarabel_CscMatrix_f32_i32_init(ClarabelCscMatrix_f32_i32 *ptr,
+                                     uintptr_t m,
+                                     uintptr_t n,
+                                     const int32_t *colptr,
+                                     const int32_t *rowval,
+                                     const float *nzval);
+
+void clarabel_CscMatrix_f64_i32_init(ClarabelCscMatrix_f64_i32 *ptr,
+                                     uintptr_t m,
+                                     uintptr_t n,
+                                     const int32_t *colptr,
+                                     const int32_t *rowval,
+                                     const double *nzval);
+
+/// @brief Initialize a sparse matrix in Compressed Sparse Column format with 32-bit indices
+/// @param m Number of rows
+/// @param n Number of columns
+/// @param colptr CSC format column pointer array (always has length n+1)
+/// @param rowval Array of row indices (always has length colptr[n])
+/// @param nzval Array of nonzero values (always has length colptr[n])
+static inline void clarabel_CscMatrix_i32_init(ClarabelCscMatrix_i32 *ptr,
+                                               uintptr_t m,
+                                               uintptr_t n,
+                                               const int32_t *colptr,
+                                               const int32_t *rowval,
+                                               const ClarabelFloat *nzval)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_CscMatrix_f32_i32_init(ptr, m, n, colptr, rowval, nzval);
+#else
+    clarabel_CscMatrix_f64_i32_init(ptr, m, n, colptr, rowval, nzval);
+#endif
+}
+
 #endif /* CLARABEL_CSC_MATRIX_H */
\ No newline at end of file
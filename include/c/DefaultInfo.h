@@ -62,10 +62,99 @@ typedef struct ClarabelDefaultInfo_f32
     // NB : `PrintStream stream` not passed to C API
 } ClarabelDefaultInfo_f32;
 
+// Wall clock timings (seconds) and counters accumulated over the lifetime of a solver
+typedef struct ClarabelDefaultTimings
+{
+    double setup_time;      // presolve, equilibration, KKT assembly and factorisation
+    double solve_time;      // total time spent in solve
+    double last_solve_time; // time spent in the most recent solve
+    double update_time;     // total time spent in data updates
+    uint32_t solve_count;
+    uint32_t update_count;
+    uint32_t iterations;    // total IP iterations, one numeric KKT factorisation each
+    uint32_t symbolic_count; // symbolic KKT analyses: one per build, carried over by clones
+} ClarabelDefaultTimings;
+
+// Progress record written once per iteration by the iteration observer
+typedef struct ClarabelIterationRecord_f64
+{
+    double elapsed;         // seconds since the start of the current solve
+    uint32_t iteration;
+    double mu;
+    double sigma;
+    double step_length;
+    double cost_primal;
+    double cost_dual;
+    double res_primal;
+    double res_dual;
+    double res_primal_inf;
+    double res_dual_inf;
+    double gap_abs;
+    double gap_rel;
+    double ktratio;
+} ClarabelIterationRecord_f64;
+
+typedef struct ClarabelIterationRecord_f32
+{
+    double elapsed;
+    uint32_t iteration;
+    float mu;
+    float sigma;
+    float step_length;
+    float cost_primal;
+    float cost_dual;
+    float res_primal;
+    float res_dual;
+    float res_primal_inf;
+    float res_dual_inf;
+    float gap_abs;
+    float gap_rel;
+    float ktratio;
+} ClarabelIterationRecord_f32;
+
+// head is updated atomically and needs the 8-byte alignment that uint64_t members lack
+// on some 32-bit targets
+#if defined(_MSC_VER)
+#define CLARABEL_ALIGN_8 __declspec(align(8))
+#elif defined(__GNUC__) || defined(__clang__)
+#define CLARABEL_ALIGN_8 __attribute__((aligned(8)))
+#else
+#define CLARABEL_ALIGN_8
+#endif
+
+// Caller-owned ring buffer for iteration records.  Record k of the solver's lifetime
+// is written to records[k % capacity], after which head is set to k+1 with release
+// ordering.  A slot holds record k only until record k + capacity overwrites it, with
+// no check on readers, so during a solve a copy of record k is intact only if the head
+// loaded after taking the copy is below k + capacity.  While a solve may be running,
+// read head only with clarabel_IterationRing_load_head and leave records and capacity
+// unchanged.
+typedef struct ClarabelIterationRing_f64
+{
+    ClarabelIterationRecord_f64 *records;
+    uintptr_t capacity;
+    CLARABEL_ALIGN_8 uint64_t head;
+} ClarabelIterationRing_f64;
+
+typedef struct ClarabelIterationRing_f32
+{
+    ClarabelIterationRecord_f32 *records;
+    uintptr_t capacity;
+    CLARABEL_ALIGN_8 uint64_t head;
+} ClarabelIterationRing_f32;
+
 #ifdef CLARABEL_USE_FLOAT
 typedef ClarabelDefaultInfo_f32 ClarabelDefaultInfo;
 #else
 typedef ClarabelDefaultInfo_f64 ClarabelDefaultInfo;
 #endif /* CLARABEL_USE_FLOAT */
 
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelIterationRecord_f32 ClarabelIterationRecord;
+typedef ClarabelIterationRing_f32 ClarabelIterationRing;
+#else
+typedef ClarabelIterationRecord_f64 ClarabelIterationRecord;
+typedef ClarabelIterationRing_f64 ClarabelIterationRing;
+#endif /* CLARABEL_USE_FLOAT */
+
 #endif
\ No newline at end of file
@@ -142,6 +142,17 @@ typedef ClarabelDefaultSettings_f32 ClarabelDefaultSettings;
 typedef ClarabelDefaultSettings_f64 ClarabelDefaultSettings;
 #endif
 
+// Opaque handle to settings that have been converted and validated once, see
+// clarabel_DefaultSettings_compile
+typedef void ClarabelDefaultSettingsHandle_f64;
+typedef void ClarabelDefaultSettingsHandle_f32;
+
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelDefaultSettingsHandle_f32 ClarabelDefaultSettingsHandle;
+#else
+typedef ClarabelDefaultSettingsHandle_f64 ClarabelDefaultSettingsHandle;
+#endif
+
 
 // ClarabelDefaultSettings APIs
 
@@ -159,4 +170,34 @@ static inline ClarabelDefaultSettings clarabel_DefaultSettings_default(void)
 #endif
 }
 
+// ClarabelDefaultSettings::compile
+// Converts and validates the settings once, for constructing many solvers with
+// clarabel_DefaultSolver_new_with_settings_handle.  Returns NULL if the settings
+// are invalid.  The handle must be released with clarabel_DefaultSettings_free_handle.
+ClarabelDefaultSettingsHandle_f64 *clarabel_DefaultSettings_f64_compile(const ClarabelDefaultSettings_f64 *settings);
+
+ClarabelDefaultSettingsHandle_f32 *clarabel_DefaultSettings_f32_compile(const ClarabelDefaultSettings_f32 *settings);
+
+static inline ClarabelDefaultSettingsHandle *clarabel_DefaultSettings_compile(const ClarabelDefaultSettings *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSettings_f32_compile(settings);
+#else
+    return clarabel_DefaultSettings_f64_compile(settings);
+#endif
+}
+
+void clarabel_DefaultSettings_f64_free_handle(ClarabelDefaultSettingsHandle_f64 *handle);
+
+void clarabel_DefaultSettings_f32_free_handle(ClarabelDefaultSettingsHandle_f32 *handle);
+
+static inline void clarabel_DefaultSettings_free_handle(ClarabelDefaultSettingsHandle *handle)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSettings_f32_free_handle(handle);
+#else
+    clarabel_DefaultSettings_f64_free_handle(handle);
+#endif
+}
+
 #endif /* CLARABEL_DEFAULT_SETTINGS_H */
\ No newline at end of file
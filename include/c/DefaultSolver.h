@@ -1,6 +1,7 @@
 #ifndef CLARABEL_DEFAULT_SOLVER_H
 #define CLARABEL_DEFAULT_SOLVER_H
 
+#include "CancelToken.h"
 #include "ClarabelTypes.h"
 #include "CscMatrix.h"
 #include "DefaultInfo.h"
@@ -57,6 +58,167 @@ static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new(const ClarabelCs
 #endif
 }
 
+// DefaultSolver::new, for matrices with 32-bit indices
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_new_i32(const ClarabelCscMatrix_f64_i32 *P,
+                                                              const double *q,
+                                                              const ClarabelCscMatrix_f64_i32 *A,
+                                                              const double *b,
+                                                              uintptr_t n_cones,
+                                                              const ClarabelSupportedConeT_f64 *cones,
+                                                              const ClarabelDefaultSettings_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_new_i32(const ClarabelCscMatrix_f32_i32 *P,
+                                                              const float *q,
+                                                              const ClarabelCscMatrix_f32_i32 *A,
+                                                              const float *b,
+                                                              uintptr_t n_cones,
+                                                              const ClarabelSupportedConeT_f32 *cones,
+                                                              const ClarabelDefaultSettings_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new_i32(const ClarabelCscMatrix_i32 *P,
+                                                                    const ClarabelFloat *q,
+                                                                    const ClarabelCscMatrix_i32 *A,
+                                                                    const ClarabelFloat *b,
+                                                                    uintptr_t n_cones,
+                                                                    const ClarabelSupportedConeT *cones,
+                                                                    const ClarabelDefaultSettings *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_new_i32(P, q, A, b, n_cones, cones, settings);
+#else
+    return clarabel_DefaultSolver_f64_new_i32(P, q, A, b, n_cones, cones, settings);
+#endif
+}
+
+// DefaultSolver::new, keeping a copy of the problem data in the solver.  The copy is
+// kept in step with data updates and is needed by clone, save_binary, solve_kkt and
+// backward.  Solvers from clarabel_DefaultSolver_new do not keep it.
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_new_keep_data(const ClarabelCscMatrix_f64 *P,
+                                                                    const double *q,
+                                                                    const ClarabelCscMatrix_f64 *A,
+                                                                    const double *b,
+                                                                    uintptr_t n_cones,
+                                                                    const ClarabelSupportedConeT_f64 *cones,
+                                                                    const ClarabelDefaultSettings_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_new_keep_data(const ClarabelCscMatrix_f32 *P,
+                                                                    const float *q,
+                                                                    const ClarabelCscMatrix_f32 *A,
+                                                                    const float *b,
+                                                                    uintptr_t n_cones,
+                                                                    const ClarabelSupportedConeT_f32 *cones,
+                                                                    const ClarabelDefaultSettings_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new_keep_data(const ClarabelCscMatrix *P,
+                                                                          const ClarabelFloat *q,
+                                                                          const ClarabelCscMatrix *A,
+                                                                          const ClarabelFloat *b,
+                                                                          uintptr_t n_cones,
+                                                                          const ClarabelSupportedConeT *cones,
+                                                                          const ClarabelDefaultSettings *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_new_keep_data(P, q, A, b, n_cones, cones, settings);
+#else
+    return clarabel_DefaultSolver_f64_new_keep_data(P, q, A, b, n_cones, cones, settings);
+#endif
+}
+
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_new_i32_keep_data(const ClarabelCscMatrix_f64_i32 *P,
+                                                                        const double *q,
+                                                                        const ClarabelCscMatrix_f64_i32 *A,
+                                                                        const double *b,
+                                                                        uintptr_t n_cones,
+                                                                        const ClarabelSupportedConeT_f64 *cones,
+                                                                        const ClarabelDefaultSettings_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_new_i32_keep_data(const ClarabelCscMatrix_f32_i32 *P,
+                                                                        const float *q,
+                                                                        const ClarabelCscMatrix_f32_i32 *A,
+                                                                        const float *b,
+                                                                        uintptr_t n_cones,
+                                                                        const ClarabelSupportedConeT_f32 *cones,
+                                                                        const ClarabelDefaultSettings_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new_i32_keep_data(const ClarabelCscMatrix_i32 *P,
+                                                                              const ClarabelFloat *q,
+                                                                              const ClarabelCscMatrix_i32 *A,
+                                                                              const ClarabelFloat *b,
+                                                                              uintptr_t n_cones,
+                                                                              const ClarabelSupportedConeT *cones,
+                                                                              const ClarabelDefaultSettings *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_new_i32_keep_data(P, q, A, b, n_cones, cones, settings);
+#else
+    return clarabel_DefaultSolver_f64_new_i32_keep_data(P, q, A, b, n_cones, cones, settings);
+#endif
+}
+
+// DefaultSolver::new, with settings from clarabel_DefaultSettings_compile.  The handle
+// is not consumed and can be reused for any number of solvers.
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_new_with_settings_handle(const ClarabelCscMatrix_f64 *P,
+                                                                               const double *q,
+                                                                               const ClarabelCscMatrix_f64 *A,
+                                                                               const double *b,
+                                                                               uintptr_t n_cones,
+                                                                               const ClarabelSupportedConeT_f64 *cones,
+                                                                               const ClarabelDefaultSettingsHandle_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_new_with_settings_handle(const ClarabelCscMatrix_f32 *P,
+                                                                               const float *q,
+                                                                               const ClarabelCscMatrix_f32 *A,
+                                                                               const float *b,
+                                                                               uintptr_t n_cones,
+                                                                               const ClarabelSupportedConeT_f32 *cones,
+                                                                               const ClarabelDefaultSettingsHandle_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new_with_settings_handle(const ClarabelCscMatrix *P,
+                                                                                     const ClarabelFloat *q,
+                                                                                     const ClarabelCscMatrix *A,
+                                                                                     const ClarabelFloat *b,
+                                                                                     uintptr_t n_cones,
+                                                                                     const ClarabelSupportedConeT *cones,
+                                                                                     const ClarabelDefaultSettingsHandle *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_new_with_settings_handle(P, q, A, b, n_cones, cones, settings);
+#else
+    return clarabel_DefaultSolver_f64_new_with_settings_handle(P, q, A, b, n_cones, cones, settings);
+#endif
+}
+
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_new_i32_with_settings_handle(const ClarabelCscMatrix_f64_i32 *P,
+                                                                                   const double *q,
+                                                                                   const ClarabelCscMatrix_f64_i32 *A,
+                                                                                   const double *b,
+                                                                                   uintptr_t n_cones,
+                                                                                   const ClarabelSupportedConeT_f64 *cones,
+                                                                                   const ClarabelDefaultSettingsHandle_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_new_i32_with_settings_handle(const ClarabelCscMatrix_f32_i32 *P,
+                                                                                   const float *q,
+                                                                                   const ClarabelCscMatrix_f32_i32 *A,
+                                                                                   const float *b,
+                                                                                   uintptr_t n_cones,
+                                                                                   const ClarabelSupportedConeT_f32 *cones,
+                                                                                   const ClarabelDefaultSettingsHandle_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_new_i32_with_settings_handle(const ClarabelCscMatrix_i32 *P,
+                                                                                         const ClarabelFloat *q,
+                                                                                         const ClarabelCscMatrix_i32 *A,
+                                                                                         const ClarabelFloat *b,
+                                                                                         uintptr_t n_cones,
+                                                                                         const ClarabelSupportedConeT *cones,
+                                                                                         const ClarabelDefaultSettingsHandle *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_new_i32_with_settings_handle(P, q, A, b, n_cones, cones, settings);
+#else
+    return clarabel_DefaultSolver_f64_new_i32_with_settings_handle(P, q, A, b, n_cones, cones, settings);
+#endif
+}
+
 #ifdef FEATURE_SERDE 
 // DefaultSolver::load_from_file
 ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_load_from_file(const char *filename);
@@ -89,6 +251,42 @@ void clarabel_DefaultSolver_f32_save_to_file(ClarabelDefaultSolver_f32 *solver,
     #endif // CLARABEL_USE_FLOAT
 #endif // FEATURE_SERDE
 
+// DefaultSolver::save_binary
+// Writes the problem data and settings to a compact binary snapshot.  Returns false if
+// the file cannot be written or the solver does not hold its problem data (see
+// clarabel_DefaultSolver_new_keep_data).
+bool clarabel_DefaultSolver_f64_save_binary(ClarabelDefaultSolver_f64 *solver, const char *filename);
+
+bool clarabel_DefaultSolver_f32_save_binary(ClarabelDefaultSolver_f32 *solver, const char *filename);
+
+static inline bool clarabel_DefaultSolver_save_binary(ClarabelDefaultSolver *solver, const char *filename)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_save_binary(solver, filename);
+#else
+    return clarabel_DefaultSolver_f64_save_binary(solver, filename);
+#endif
+}
+
+// DefaultSolver::load_binary
+// Builds a solver from a snapshot written by save_binary with the same build of the
+// library.  The stored settings are used if settings is NULL.  Returns NULL on failure.
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_load_binary(const char *filename,
+                                                                  const ClarabelDefaultSettings_f64 *settings);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_load_binary(const char *filename,
+                                                                  const ClarabelDefaultSettings_f32 *settings);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_load_binary(const char *filename,
+                                                                        const ClarabelDefaultSettings *settings)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_load_binary(filename, settings);
+#else
+    return clarabel_DefaultSolver_f64_load_binary(filename, settings);
+#endif
+}
+
 // DefaultSolver::print_to_stdout
 void clarabel_DefaultSolver_f64_print_to_stdout(ClarabelDefaultSolver_f64 *solver);
 void clarabel_DefaultSolver_f32_print_to_stdout(ClarabelDefaultSolver_f32 *solver);
@@ -154,6 +352,54 @@ static inline const char* clarabel_DefaultSolver_get_print_buffer(ClarabelDefaul
     }
 #endif // CLARABEL_USE_FLOAT
 
+// DefaultSolver::print_to_fixed_buffer
+// Output is written into a buffer owned by the caller, which must stay valid
+// while the solver prints to it.  Output beyond `capacity` bytes is dropped and
+// no terminating null is written.  The number of bytes written so far is
+// returned by clarabel_DefaultSolver_fixed_buffer_len.
+void clarabel_DefaultSolver_f64_print_to_fixed_buffer(ClarabelDefaultSolver_f64 *solver, char *buffer, uintptr_t capacity);
+void clarabel_DefaultSolver_f32_print_to_fixed_buffer(ClarabelDefaultSolver_f32 *solver, char *buffer, uintptr_t capacity);
+uintptr_t clarabel_DefaultSolver_f64_fixed_buffer_len(ClarabelDefaultSolver_f64 *solver);
+uintptr_t clarabel_DefaultSolver_f32_fixed_buffer_len(ClarabelDefaultSolver_f32 *solver);
+#ifdef CLARABEL_USE_FLOAT
+    static inline void clarabel_DefaultSolver_print_to_fixed_buffer(ClarabelDefaultSolver *solver, char *buffer, uintptr_t capacity)
+    {
+        clarabel_DefaultSolver_f32_print_to_fixed_buffer(solver, buffer, capacity);
+    }
+    static inline uintptr_t clarabel_DefaultSolver_fixed_buffer_len(ClarabelDefaultSolver *solver)
+    {
+        return clarabel_DefaultSolver_f32_fixed_buffer_len(solver);
+    }
+#else
+    static inline void clarabel_DefaultSolver_print_to_fixed_buffer(ClarabelDefaultSolver *solver, char *buffer, uintptr_t capacity)
+    {
+        clarabel_DefaultSolver_f64_print_to_fixed_buffer(solver, buffer, capacity);
+    }
+    static inline uintptr_t clarabel_DefaultSolver_fixed_buffer_len(ClarabelDefaultSolver *solver)
+    {
+        return clarabel_DefaultSolver_f64_fixed_buffer_len(solver);
+    }
+#endif // CLARABEL_USE_FLOAT
+
+// DefaultSolver::print_to_callback
+// Each chunk of output is passed to `callback`.  The data is not null
+// terminated and is only valid for the duration of the call.  Passing a null
+// callback discards all output.
+typedef void (*ClarabelPrintCallback)(const char *data, uintptr_t len, void *userdata);
+void clarabel_DefaultSolver_f64_print_to_callback(ClarabelDefaultSolver_f64 *solver, ClarabelPrintCallback callback, void *userdata);
+void clarabel_DefaultSolver_f32_print_to_callback(ClarabelDefaultSolver_f32 *solver, ClarabelPrintCallback callback, void *userdata);
+#ifdef CLARABEL_USE_FLOAT
+    static inline void clarabel_DefaultSolver_print_to_callback(ClarabelDefaultSolver *solver, ClarabelPrintCallback callback, void *userdata)
+    {
+        clarabel_DefaultSolver_f32_print_to_callback(solver, callback, userdata);
+    }
+#else
+    static inline void clarabel_DefaultSolver_print_to_callback(ClarabelDefaultSolver *solver, ClarabelPrintCallback callback, void *userdata)
+    {
+        clarabel_DefaultSolver_f64_print_to_callback(solver, callback, userdata);
+    }
+#endif // CLARABEL_USE_FLOAT
+
 
 // DefaultSolver::solve
 void clarabel_DefaultSolver_f64_solve(ClarabelDefaultSolver_f64 *solver);
@@ -169,6 +415,36 @@ static inline void clarabel_DefaultSolver_solve(ClarabelDefaultSolver *solver)
 #endif
 }
 
+// DefaultSolver::solve_async
+// Queue a solve on one of the library's worker threads, which are shared by all solvers
+// and started on demand up to the global thread count, one per core unless set with
+// clarabel_set_global_thread_pool.  When the solve terminates, completion is called on
+// the worker thread with the solver, its info and userdata; it may be NULL.  info is
+// NULL if the solve failed with an internal error, in which case the state of the
+// solver is unspecified.  Until then the solver must not be used or freed.  A running solve can be stopped
+// early through a cancellation token or termination callback attached beforehand.
+typedef void (*ClarabelSolveCompletion_f64)(ClarabelDefaultSolver_f64 *solver, const ClarabelDefaultInfo_f64 *info, void *userdata);
+typedef void (*ClarabelSolveCompletion_f32)(ClarabelDefaultSolver_f32 *solver, const ClarabelDefaultInfo_f32 *info, void *userdata);
+
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelSolveCompletion_f32 ClarabelSolveCompletion;
+#else
+typedef ClarabelSolveCompletion_f64 ClarabelSolveCompletion;
+#endif
+
+void clarabel_DefaultSolver_f64_solve_async(ClarabelDefaultSolver_f64 *solver, ClarabelSolveCompletion_f64 completion, void *userdata);
+
+void clarabel_DefaultSolver_f32_solve_async(ClarabelDefaultSolver_f32 *solver, ClarabelSolveCompletion_f32 completion, void *userdata);
+
+static inline void clarabel_DefaultSolver_solve_async(ClarabelDefaultSolver *solver, ClarabelSolveCompletion completion, void *userdata)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_solve_async(solver, completion, userdata);
+#else
+    clarabel_DefaultSolver_f64_solve_async(solver, completion, userdata);
+#endif
+}
+
 // DefaultSolver::free
 void clarabel_DefaultSolver_f64_free(ClarabelDefaultSolver_f64 *solver);
 
@@ -197,6 +473,120 @@ static inline ClarabelDefaultSolution clarabel_DefaultSolver_solution(ClarabelDe
 #endif
 }
 
+// DefaultSolver::copy_solution
+// Copies x (length n), z and s (length m) into caller-owned buffers.  Any of
+// x, z or s may be NULL, in which case that vector is skipped.  Returns false and
+// copies nothing if n or m does not match the problem.
+bool clarabel_DefaultSolver_f64_copy_solution(ClarabelDefaultSolver_f64 *solver,
+                                              double *x,
+                                              uintptr_t n,
+                                              double *z,
+                                              double *s,
+                                              uintptr_t m);
+
+bool clarabel_DefaultSolver_f32_copy_solution(ClarabelDefaultSolver_f32 *solver,
+                                              float *x,
+                                              uintptr_t n,
+                                              float *z,
+                                              float *s,
+                                              uintptr_t m);
+
+static inline bool clarabel_DefaultSolver_copy_solution(ClarabelDefaultSolver *solver,
+                                                        ClarabelFloat *x,
+                                                        uintptr_t n,
+                                                        ClarabelFloat *z,
+                                                        ClarabelFloat *s,
+                                                        uintptr_t m)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_copy_solution(solver, x, n, z, s, m);
+#else
+    return clarabel_DefaultSolver_f64_copy_solution(solver, x, n, z, s, m);
+#endif
+}
+
+// DefaultSolver::solve_kkt
+// Solves the KKT system of the last solution, [P A'; A -H] [dx; dz] = rhs, for each
+// right hand side in turn, for example to find the sensitivity of the solution to q or b.
+// H is the diagonal of s./z at the solution, zero on equality constraints.  rhs is a
+// column-major dim x nrhs array with dim = n+m and is overwritten by the solutions.  The
+// factors are kept for further calls until the next solve or data update.  Returns false
+// if dim is wrong, the last solve did not end Solved or AlmostSolved, the data was updated
+// since the last solve, the solver does not hold its problem data (see
+// clarabel_DefaultSolver_new_keep_data) or has cones other than zero and nonnegative
+// cones, or the system cannot be factored.
+bool clarabel_DefaultSolver_f64_solve_kkt(ClarabelDefaultSolver_f64 *solver, double *rhs, uintptr_t dim, uintptr_t nrhs);
+
+bool clarabel_DefaultSolver_f32_solve_kkt(ClarabelDefaultSolver_f32 *solver, float *rhs, uintptr_t dim, uintptr_t nrhs);
+
+static inline bool clarabel_DefaultSolver_solve_kkt(ClarabelDefaultSolver *solver,
+                                                    ClarabelFloat *rhs,
+                                                    uintptr_t dim,
+                                                    uintptr_t nrhs)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_solve_kkt(solver, rhs, dim, nrhs);
+#else
+    return clarabel_DefaultSolver_f64_solve_kkt(solver, rhs, dim, nrhs);
+#endif
+}
+
+// DefaultSolver::backward
+// Gradients of a loss with respect to the problem data, given its gradients dx (length
+// n), dz and ds (length m) with respect to the solution.  The solution map is
+// differentiated implicitly through the KKT system of clarabel_DefaultSolver_solve_kkt,
+// at the cost of one solve with the factors kept by solve_kkt, factoring if needed.  dP
+// and dA receive the gradients with respect to the nonzero values of P and A; an
+// off-diagonal entry of P above the diagonal stands for both of its symmetric positions,
+// and entries below the diagonal, which the solver does not use, receive zero.  NULL inputs are taken as zero and NULL outputs are
+// skipped.  Returns false if a dimension does not match the problem or in the cases
+// where clarabel_DefaultSolver_solve_kkt fails.
+bool clarabel_DefaultSolver_f64_backward(ClarabelDefaultSolver_f64 *solver,
+                                         const double *dx,
+                                         const double *dz,
+                                         const double *ds,
+                                         double *dP,
+                                         uintptr_t nnzP,
+                                         double *dq,
+                                         uintptr_t n,
+                                         double *dA,
+                                         uintptr_t nnzA,
+                                         double *db,
+                                         uintptr_t m);
+
+bool clarabel_DefaultSolver_f32_backward(ClarabelDefaultSolver_f32 *solver,
+                                         const float *dx,
+                                         const float *dz,
+                                         const float *ds,
+                                         float *dP,
+                                         uintptr_t nnzP,
+                                         float *dq,
+                                         uintptr_t n,
+                                         float *dA,
+                                         uintptr_t nnzA,
+                                         float *db,
+                                         uintptr_t m);
+
+static inline bool clarabel_DefaultSolver_backward(ClarabelDefaultSolver *solver,
+                                                   const ClarabelFloat *dx,
+                                                   const ClarabelFloat *dz,
+                                                   const ClarabelFloat *ds,
+                                                   ClarabelFloat *dP,
+                                                   uintptr_t nnzP,
+                                                   ClarabelFloat *dq,
+                                                   uintptr_t n,
+                                                   ClarabelFloat *dA,
+                                                   uintptr_t nnzA,
+                                                   ClarabelFloat *db,
+                                                   uintptr_t m)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_backward(solver, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m);
+#else
+    return clarabel_DefaultSolver_f64_backward(solver, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m);
+#endif
+}
+
 // DefaultSolver::info
 ClarabelDefaultInfo_f64 clarabel_DefaultSolver_f64_info(ClarabelDefaultSolver_f64 *solver);
 
@@ -211,6 +601,34 @@ static inline ClarabelDefaultInfo clarabel_DefaultSolver_info(ClarabelDefaultSol
 #endif
 }
 
+// DefaultSolver::timings
+ClarabelDefaultTimings clarabel_DefaultSolver_f64_timings(ClarabelDefaultSolver_f64 *solver);
+
+ClarabelDefaultTimings clarabel_DefaultSolver_f32_timings(ClarabelDefaultSolver_f32 *solver);
+
+static inline ClarabelDefaultTimings clarabel_DefaultSolver_timings(ClarabelDefaultSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_timings(solver);
+#else
+    return clarabel_DefaultSolver_f64_timings(solver);
+#endif
+}
+
+// Clears the solve and update counters.  The setup time is kept.
+void clarabel_DefaultSolver_f64_reset_timings(ClarabelDefaultSolver_f64 *solver);
+
+void clarabel_DefaultSolver_f32_reset_timings(ClarabelDefaultSolver_f32 *solver);
+
+static inline void clarabel_DefaultSolver_reset_timings(ClarabelDefaultSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_reset_timings(solver);
+#else
+    clarabel_DefaultSolver_f64_reset_timings(solver);
+#endif
+}
+
 // DefaultSolver callbacks
 typedef int (*ClarabelCallbackFcn_f32)(ClarabelDefaultInfo_f32 *info, void* userdata);
 typedef int (*ClarabelCallbackFcn_f64)(ClarabelDefaultInfo_f64 *info, void* userdata);
@@ -246,6 +664,105 @@ static inline void clarabel_DefaultSolver_unset_termination_callback(ClarabelDef
 }
 
 
+// DefaultSolver::set_cancel_token
+// Poll a cancellation token at every iteration boundary.  The solver keeps its own
+// reference to the token; pass NULL to detach it.  Can be combined with a termination
+// callback and an iteration observer.
+void clarabel_DefaultSolver_f64_set_cancel_token(ClarabelDefaultSolver_f64 *solver, const ClarabelCancelToken *token);
+void clarabel_DefaultSolver_f32_set_cancel_token(ClarabelDefaultSolver_f32 *solver, const ClarabelCancelToken *token);
+
+static inline void clarabel_DefaultSolver_set_cancel_token(ClarabelDefaultSolver *solver, const ClarabelCancelToken *token)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_set_cancel_token(solver, token);
+#else
+    clarabel_DefaultSolver_f64_set_cancel_token(solver, token);
+#endif
+}
+
+// DefaultSolver::set_iteration_observer
+// Writes one ClarabelIterationRecord per iteration into a caller-owned ring buffer,
+// without allocating.  The ring must stay valid while attached; pass NULL to detach.
+// Can be combined with a termination callback.
+void clarabel_DefaultSolver_f64_set_iteration_observer(ClarabelDefaultSolver_f64 *solver, ClarabelIterationRing_f64 *ring);
+void clarabel_DefaultSolver_f32_set_iteration_observer(ClarabelDefaultSolver_f32 *solver, ClarabelIterationRing_f32 *ring);
+
+static inline void clarabel_DefaultSolver_set_iteration_observer(ClarabelDefaultSolver *solver, ClarabelIterationRing *ring)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_set_iteration_observer(solver, ring);
+#else
+    clarabel_DefaultSolver_f64_set_iteration_observer(solver, ring);
+#endif
+}
+
+// Loads the head of a ring with acquire ordering.  The records below the returned head,
+// and no more than capacity of them, are complete and can be read during a solve.  The
+// load is ordered after the caller's earlier reads of records, so loading head again
+// after copying record k tells whether the copy is intact (see ClarabelIterationRing).
+uint64_t clarabel_IterationRing_f64_load_head(const ClarabelIterationRing_f64 *ring);
+uint64_t clarabel_IterationRing_f32_load_head(const ClarabelIterationRing_f32 *ring);
+
+static inline uint64_t clarabel_IterationRing_load_head(const ClarabelIterationRing *ring)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_IterationRing_f32_load_head(ring);
+#else
+    return clarabel_IterationRing_f64_load_head(ring);
+#endif
+}
+
+
+// DefaultSolver::clone
+// Builds an independent solver from the current problem data and settings of
+// the original.  The setup phase is repeated; termination callbacks and
+// iteration observers are not copied.  Returns NULL for solvers that do not hold
+// their problem data (see clarabel_DefaultSolver_new_keep_data).
+ClarabelDefaultSolver_f64 *clarabel_DefaultSolver_f64_clone(ClarabelDefaultSolver_f64 *solver);
+
+ClarabelDefaultSolver_f32 *clarabel_DefaultSolver_f32_clone(ClarabelDefaultSolver_f32 *solver);
+
+static inline ClarabelDefaultSolver *clarabel_DefaultSolver_clone(ClarabelDefaultSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_clone(solver);
+#else
+    return clarabel_DefaultSolver_f64_clone(solver);
+#endif
+}
+
+// DefaultSolver::set_pattern_locked
+// Value updates always reuse the symbolic KKT analysis from construction, and CSC
+// updates of P and A with a different sparsity pattern are rejected by the solver's own
+// check of the new matrix.  When the pattern is locked, solvers built with the _keep_data
+// constructors also check CSC updates against their copy of the data before the solver
+// sees them.
+void clarabel_DefaultSolver_f64_set_pattern_locked(ClarabelDefaultSolver_f64 *solver, bool locked);
+
+void clarabel_DefaultSolver_f32_set_pattern_locked(ClarabelDefaultSolver_f32 *solver, bool locked);
+
+static inline void clarabel_DefaultSolver_set_pattern_locked(ClarabelDefaultSolver *solver, bool locked)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_set_pattern_locked(solver, locked);
+#else
+    clarabel_DefaultSolver_f64_set_pattern_locked(solver, locked);
+#endif
+}
+
+bool clarabel_DefaultSolver_f64_pattern_locked(ClarabelDefaultSolver_f64 *solver);
+
+bool clarabel_DefaultSolver_f32_pattern_locked(ClarabelDefaultSolver_f32 *solver);
+
+static inline bool clarabel_DefaultSolver_pattern_locked(ClarabelDefaultSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_pattern_locked(solver);
+#else
+    return clarabel_DefaultSolver_f64_pattern_locked(solver);
+#endif
+}
+
 ////// P data updating 
 
 // DefaultSolver::update_P (full rewrite of sparse nonzeros)
@@ -274,16 +791,58 @@ static inline void clarabel_DefaultSolver_update_P_partial(ClarabelDefaultSolver
 #endif
 }
 
+// DefaultSolver::update_P_sorted (partial rewrite with strictly increasing indices).
+// The indices are validated once and the values scattered without per-entry checks.
+// Returns false, leaving the data unchanged, if the indices are not strictly
+// increasing or out of range.  The _i32 variant takes 32-bit indices.
+bool clarabel_DefaultSolver_f64_update_P_sorted(ClarabelDefaultSolver_f64 *solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_P_sorted(ClarabelDefaultSolver_f32 *solver, const uintptr_t* index, const float  *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_P_sorted_i32(ClarabelDefaultSolver_f64 *solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_P_sorted_i32(ClarabelDefaultSolver_f32 *solver, const int32_t* index, const float  *values, uintptr_t nvals);
+
+static inline bool clarabel_DefaultSolver_update_P_sorted(ClarabelDefaultSolver *solver, const uintptr_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_P_sorted(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_P_sorted(solver, index, values, nvals);
+#endif
+}
+
+static inline bool clarabel_DefaultSolver_update_P_sorted_i32(ClarabelDefaultSolver *solver, const int32_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_P_sorted_i32(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_P_sorted_i32(solver, index, values, nvals);
+#endif
+}
+
 // DefaultSolver::update_P (full rewrite of sparse matrix data using CSC formatted source)
-void clarabel_DefaultSolver_f64_update_P_csc(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64 *P);
-void clarabel_DefaultSolver_f32_update_P_csc(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32 *P);
+// Returns false and leaves the solver unchanged if the pattern does not match, see
+// clarabel_DefaultSolver_set_pattern_locked.
+bool clarabel_DefaultSolver_f64_update_P_csc(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64 *P);
+bool clarabel_DefaultSolver_f32_update_P_csc(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32 *P);
 
-static inline void clarabel_DefaultSolver_update_P_csc(ClarabelDefaultSolver *solver, const ClarabelCscMatrix *P)
+static inline bool clarabel_DefaultSolver_update_P_csc(ClarabelDefaultSolver *solver, const ClarabelCscMatrix *P)
 {
 #ifdef CLARABEL_USE_FLOAT
-    clarabel_DefaultSolver_f32_update_P_csc(solver,P);
+    return clarabel_DefaultSolver_f32_update_P_csc(solver,P);
 #else
-    clarabel_DefaultSolver_f64_update_P_csc(solver,P);
+    return clarabel_DefaultSolver_f64_update_P_csc(solver,P);
+#endif
+}
+
+// DefaultSolver::update_P (as above, for a CSC source with 32-bit indices)
+bool clarabel_DefaultSolver_f64_update_P_csc_i32(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64_i32 *P);
+bool clarabel_DefaultSolver_f32_update_P_csc_i32(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32_i32 *P);
+
+static inline bool clarabel_DefaultSolver_update_P_csc_i32(ClarabelDefaultSolver *solver, const ClarabelCscMatrix_i32 *P)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_P_csc_i32(solver,P);
+#else
+    return clarabel_DefaultSolver_f64_update_P_csc_i32(solver,P);
 #endif
 }
 
@@ -316,16 +875,55 @@ static inline void clarabel_DefaultSolver_update_A_partial(ClarabelDefaultSolver
 #endif
 }
 
-// DefaultSolver::update_P (full rewrite of sparse matrix data using CSC formatted source)
-void clarabel_DefaultSolver_f64_update_A_csc(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64 *A);
-void clarabel_DefaultSolver_f32_update_A_csc(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32 *A);
+// DefaultSolver::update_A_sorted (as update_P_sorted)
+bool clarabel_DefaultSolver_f64_update_A_sorted(ClarabelDefaultSolver_f64 *solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_A_sorted(ClarabelDefaultSolver_f32 *solver, const uintptr_t* index, const float  *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_A_sorted_i32(ClarabelDefaultSolver_f64 *solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_A_sorted_i32(ClarabelDefaultSolver_f32 *solver, const int32_t* index, const float  *values, uintptr_t nvals);
 
-static inline void clarabel_DefaultSolver_update_A_csc(ClarabelDefaultSolver *solver, const ClarabelCscMatrix *A)
+static inline bool clarabel_DefaultSolver_update_A_sorted(ClarabelDefaultSolver *solver, const uintptr_t* index, const ClarabelFloat *values, uintptr_t nvals)
 {
 #ifdef CLARABEL_USE_FLOAT
-    clarabel_DefaultSolver_f32_update_A_csc(solver,A);
+    return clarabel_DefaultSolver_f32_update_A_sorted(solver, index, values, nvals);
 #else
-    clarabel_DefaultSolver_f64_update_A_csc(solver,A);
+    return clarabel_DefaultSolver_f64_update_A_sorted(solver, index, values, nvals);
+#endif
+}
+
+static inline bool clarabel_DefaultSolver_update_A_sorted_i32(ClarabelDefaultSolver *solver, const int32_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_A_sorted_i32(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_A_sorted_i32(solver, index, values, nvals);
+#endif
+}
+
+// DefaultSolver::update_A (full rewrite of sparse matrix data using CSC formatted source)
+// Returns false and leaves the solver unchanged if the pattern does not match, see
+// clarabel_DefaultSolver_set_pattern_locked.
+bool clarabel_DefaultSolver_f64_update_A_csc(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64 *A);
+bool clarabel_DefaultSolver_f32_update_A_csc(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32 *A);
+
+static inline bool clarabel_DefaultSolver_update_A_csc(ClarabelDefaultSolver *solver, const ClarabelCscMatrix *A)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_A_csc(solver,A);
+#else
+    return clarabel_DefaultSolver_f64_update_A_csc(solver,A);
+#endif
+}
+
+// DefaultSolver::update_A (as above, for a CSC source with 32-bit indices)
+bool clarabel_DefaultSolver_f64_update_A_csc_i32(ClarabelDefaultSolver_f64 *solver, const ClarabelCscMatrix_f64_i32 *A);
+bool clarabel_DefaultSolver_f32_update_A_csc_i32(ClarabelDefaultSolver_f32 *solver, const ClarabelCscMatrix_f32_i32 *A);
+
+static inline bool clarabel_DefaultSolver_update_A_csc_i32(ClarabelDefaultSolver *solver, const ClarabelCscMatrix_i32 *A)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_A_csc_i32(solver,A);
+#else
+    return clarabel_DefaultSolver_f64_update_A_csc_i32(solver,A);
 #endif
 }
 
@@ -357,6 +955,30 @@ static inline void clarabel_DefaultSolver_update_q_partial(ClarabelDefaultSolver
 #endif
 }
 
+// DefaultSolver::update_q_sorted (as update_P_sorted)
+bool clarabel_DefaultSolver_f64_update_q_sorted(ClarabelDefaultSolver_f64 *solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_q_sorted(ClarabelDefaultSolver_f32 *solver, const uintptr_t* index, const float  *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_q_sorted_i32(ClarabelDefaultSolver_f64 *solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_q_sorted_i32(ClarabelDefaultSolver_f32 *solver, const int32_t* index, const float  *values, uintptr_t nvals);
+
+static inline bool clarabel_DefaultSolver_update_q_sorted(ClarabelDefaultSolver *solver, const uintptr_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_q_sorted(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_q_sorted(solver, index, values, nvals);
+#endif
+}
+
+static inline bool clarabel_DefaultSolver_update_q_sorted_i32(ClarabelDefaultSolver *solver, const int32_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_q_sorted_i32(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_q_sorted_i32(solver, index, values, nvals);
+#endif
+}
+
 ////// b data updating 
 
 // DefaultSolver::update_A (full rewrite of sparse nonzeros)
@@ -385,6 +1007,58 @@ static inline void clarabel_DefaultSolver_update_b_partial(ClarabelDefaultSolver
 #endif
 }
 
+// DefaultSolver::update_b_sorted (as update_P_sorted)
+bool clarabel_DefaultSolver_f64_update_b_sorted(ClarabelDefaultSolver_f64 *solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_b_sorted(ClarabelDefaultSolver_f32 *solver, const uintptr_t* index, const float  *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_b_sorted_i32(ClarabelDefaultSolver_f64 *solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_b_sorted_i32(ClarabelDefaultSolver_f32 *solver, const int32_t* index, const float  *values, uintptr_t nvals);
+
+static inline bool clarabel_DefaultSolver_update_b_sorted(ClarabelDefaultSolver *solver, const uintptr_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_b_sorted(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_b_sorted(solver, index, values, nvals);
+#endif
+}
+
+static inline bool clarabel_DefaultSolver_update_b_sorted_i32(ClarabelDefaultSolver *solver, const int32_t* index, const ClarabelFloat *values, uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_DefaultSolver_f32_update_b_sorted_i32(solver, index, values, nvals);
+#else
+    return clarabel_DefaultSolver_f64_update_b_sorted_i32(solver, index, values, nvals);
+#endif
+}
+
+////// combined data updating
+
+// DefaultSolver::update_P, update_q, update_A and update_b in a single call (full rewrite
+// of each).  Pass NULL for any array that is unchanged; its length is then ignored.
+void clarabel_DefaultSolver_f64_update_data(ClarabelDefaultSolver_f64 *solver,
+                                            const double *Pnzval, uintptr_t nnzP,
+                                            const double *q, uintptr_t n,
+                                            const double *Anzval, uintptr_t nnzA,
+                                            const double *b, uintptr_t m);
+void clarabel_DefaultSolver_f32_update_data(ClarabelDefaultSolver_f32 *solver,
+                                            const float *Pnzval, uintptr_t nnzP,
+                                            const float *q, uintptr_t n,
+                                            const float *Anzval, uintptr_t nnzA,
+                                            const float *b, uintptr_t m);
+
+static inline void clarabel_DefaultSolver_update_data(ClarabelDefaultSolver *solver,
+                                                      const ClarabelFloat *Pnzval, uintptr_t nnzP,
+                                                      const ClarabelFloat *q, uintptr_t n,
+                                                      const ClarabelFloat *Anzval, uintptr_t nnzA,
+                                                      const ClarabelFloat *b, uintptr_t m)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_DefaultSolver_f32_update_data(solver, Pnzval, nnzP, q, n, Anzval, nnzA, b, m);
+#else
+    clarabel_DefaultSolver_f64_update_data(solver, Pnzval, nnzP, q, n, Anzval, nnzA, b, m);
+#endif
+}
+
 
 
 #endif /* CLARABEL_H */
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef CLARABEL_LDL_SOLVER_H
+#define CLARABEL_LDL_SOLVER_H
+
+#include "ClarabelTypes.h"
+#include "CscMatrix.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// ClarabelLdlSolver types
+typedef void ClarabelLdlSolver_f64;
+typedef void ClarabelLdlSolver_f32;
+
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelLdlSolver_f32 ClarabelLdlSolver;
+#else
+typedef ClarabelLdlSolver_f64 ClarabelLdlSolver;
+#endif
+
+// Sparse LDL APIs
+//
+// An LdlSolver holds the QDLDL factorisation that the solver uses for its KKT systems,
+// for use on other quasidefinite systems K x = b.  K is given by its upper triangle.
+// The symbolic analysis is done once when the solver is created; values may then be
+// changed and the matrix refactored any number of times with the same pattern.
+
+/// @brief Factor a square matrix given by its upper triangle
+///
+/// @param K Upper triangle of the matrix.  It is copied, so it need not outlive the solver.
+/// @param Dsigns Expected sign (+1 or -1) of each pivot, with length K->n, or NULL to
+/// factor without regularization.  When given, pivots of the wrong sign or too close to
+/// zero are regularized.
+/// @return NULL if K is not square and upper triangular, if an entry of Dsigns is not +1
+/// or -1, or if K cannot be factored
+ClarabelLdlSolver_f64 *clarabel_LdlSolver_f64_new(const ClarabelCscMatrix_f64 *K, const int8_t *Dsigns);
+
+ClarabelLdlSolver_f32 *clarabel_LdlSolver_f32_new(const ClarabelCscMatrix_f32 *K, const int8_t *Dsigns);
+
+static inline ClarabelLdlSolver *clarabel_LdlSolver_new(const ClarabelCscMatrix *K, const int8_t *Dsigns)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_LdlSolver_f32_new(K, Dsigns);
+#else
+    return clarabel_LdlSolver_f64_new(K, Dsigns);
+#endif
+}
+
+// As clarabel_LdlSolver_new, for matrices with 32-bit indices
+ClarabelLdlSolver_f64 *clarabel_LdlSolver_f64_new_i32(const ClarabelCscMatrix_f64_i32 *K, const int8_t *Dsigns);
+
+ClarabelLdlSolver_f32 *clarabel_LdlSolver_f32_new_i32(const ClarabelCscMatrix_f32_i32 *K, const int8_t *Dsigns);
+
+static inline ClarabelLdlSolver *clarabel_LdlSolver_new_i32(const ClarabelCscMatrix_i32 *K, const int8_t *Dsigns)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_LdlSolver_f32_new_i32(K, Dsigns);
+#else
+    return clarabel_LdlSolver_f64_new_i32(K, Dsigns);
+#endif
+}
+
+void clarabel_LdlSolver_f64_free(ClarabelLdlSolver_f64 *solver);
+
+void clarabel_LdlSolver_f32_free(ClarabelLdlSolver_f32 *solver);
+
+static inline void clarabel_LdlSolver_free(ClarabelLdlSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_LdlSolver_f32_free(solver);
+#else
+    clarabel_LdlSolver_f64_free(solver);
+#endif
+}
+
+/// @brief Change entries of K.  The change takes effect at the next refactor.
+///
+/// @param index Positions of the entries in the nonzero values of K
+/// @param values New values
+/// @param nvals Number of entries
+void clarabel_LdlSolver_f64_update_values(ClarabelLdlSolver_f64 *solver,
+                                          const uintptr_t *index,
+                                          const double *values,
+                                          uintptr_t nvals);
+
+void clarabel_LdlSolver_f32_update_values(ClarabelLdlSolver_f32 *solver,
+                                          const uintptr_t *index,
+                                          const float *values,
+                                          uintptr_t nvals);
+
+static inline void clarabel_LdlSolver_update_values(ClarabelLdlSolver *solver,
+                                                    const uintptr_t *index,
+                                                    const ClarabelFloat *values,
+                                                    uintptr_t nvals)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_LdlSolver_f32_update_values(solver, index, values, nvals);
+#else
+    clarabel_LdlSolver_f64_update_values(solver, index, values, nvals);
+#endif
+}
+
+/// @brief Refactor K, reusing the symbolic analysis
+///
+/// @param nzval All nonzero values of K in the original pattern, or NULL to keep the
+/// current values
+/// @param nnz Length of nzval
+/// @return false if nnz does not match K or the matrix cannot be factored
+bool clarabel_LdlSolver_f64_refactor(ClarabelLdlSolver_f64 *solver, const double *nzval, uintptr_t nnz);
+
+bool clarabel_LdlSolver_f32_refactor(ClarabelLdlSolver_f32 *solver, const float *nzval, uintptr_t nnz);
+
+static inline bool clarabel_LdlSolver_refactor(ClarabelLdlSolver *solver, const ClarabelFloat *nzval, uintptr_t nnz)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_LdlSolver_f32_refactor(solver, nzval, nnz);
+#else
+    return clarabel_LdlSolver_f64_refactor(solver, nzval, nnz);
+#endif
+}
+
+/// @brief Solve K x = b in place for one or more right hand sides
+///
+/// @param b Column-major n x nrhs array of right hand sides, overwritten by the solutions
+/// @param nrhs Number of right hand sides
+void clarabel_LdlSolver_f64_solve(ClarabelLdlSolver_f64 *solver, double *b, uintptr_t nrhs);
+
+void clarabel_LdlSolver_f32_solve(ClarabelLdlSolver_f32 *solver, float *b, uintptr_t nrhs);
+
+static inline void clarabel_LdlSolver_solve(ClarabelLdlSolver *solver, ClarabelFloat *b, uintptr_t nrhs)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_LdlSolver_f32_solve(solver, b, nrhs);
+#else
+    clarabel_LdlSolver_f64_solve(solver, b, nrhs);
+#endif
+}
+
+/// @brief Number of positive pivots of the last factorisation
+uintptr_t clarabel_LdlSolver_f64_positive_inertia(ClarabelLdlSolver_f64 *solver);
+
+uintptr_t clarabel_LdlSolver_f32_positive_inertia(ClarabelLdlSolver_f32 *solver);
+
+static inline uintptr_t clarabel_LdlSolver_positive_inertia(ClarabelLdlSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_LdlSolver_f32_positive_inertia(solver);
+#else
+    return clarabel_LdlSolver_f64_positive_inertia(solver);
+#endif
+}
+
+#endif /* CLARABEL_LDL_SOLVER_H */
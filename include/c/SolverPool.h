@@ -0,0 +1,162 @@
+#ifndef CLARABEL_SOLVER_POOL_H
+#define CLARABEL_SOLVER_POOL_H
+
+#include "ClarabelTypes.h"
+#include "CscMatrix.h"
+#include "DefaultSettings.h"
+#include "DefaultSolver.h"
+#include "SupportedConeT.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// ClarabelSolverPool types
+typedef void ClarabelSolverPool_f64;
+typedef void ClarabelSolverPool_f32;
+
+#ifdef CLARABEL_USE_FLOAT
+typedef ClarabelSolverPool_f32 ClarabelSolverPool;
+#else
+typedef ClarabelSolverPool_f64 ClarabelSolverPool;
+#endif
+
+// Solver pool APIs
+//
+// A pool keeps released solvers and hands them out again for problems with the same
+// structure: dimensions, sparsity patterns of P and A, and cones.  A recycled solver
+// keeps its KKT, factorisation, cone and residual workspace and is rebound to the new
+// q, b and values of P and A through the data update path, so no symbolic analysis or
+// workspace allocation is repeated.  All solvers of a pool use the settings the pool
+// was created with.  A pool must not be used from several threads at once.
+
+/// @brief Create a solver pool
+///
+/// @param settings Settings for every solver built by the pool
+/// @param max_idle Maximum number of released solvers kept for reuse.  Use 0 for no limit.
+ClarabelSolverPool_f64 *clarabel_SolverPool_f64_new(const ClarabelDefaultSettings_f64 *settings, uintptr_t max_idle);
+
+ClarabelSolverPool_f32 *clarabel_SolverPool_f32_new(const ClarabelDefaultSettings_f32 *settings, uintptr_t max_idle);
+
+static inline ClarabelSolverPool *clarabel_SolverPool_new(const ClarabelDefaultSettings *settings, uintptr_t max_idle)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_SolverPool_f32_new(settings, max_idle);
+#else
+    return clarabel_SolverPool_f64_new(settings, max_idle);
+#endif
+}
+
+/// @brief Free a solver pool and the solvers it holds.  Solvers handed out by the pool
+/// remain valid and must be freed with clarabel_DefaultSolver_free.
+void clarabel_SolverPool_f64_free(ClarabelSolverPool_f64 *pool);
+
+void clarabel_SolverPool_f32_free(ClarabelSolverPool_f32 *pool);
+
+static inline void clarabel_SolverPool_free(ClarabelSolverPool *pool)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_SolverPool_f32_free(pool);
+#else
+    clarabel_SolverPool_f64_free(pool);
+#endif
+}
+
+/// @brief Get a solver for a problem, recycling a released solver of the same structure
+/// when there is one and building a new one otherwise.  Arguments are as for
+/// clarabel_DefaultSolver_new.  Returns NULL if the solver cannot be built or the data
+/// does not fit it: b may be NULL only when A has no rows, and P must be n x n.
+ClarabelDefaultSolver_f64 *clarabel_SolverPool_f64_acquire(ClarabelSolverPool_f64 *pool,
+                                                           const ClarabelCscMatrix_f64 *P,
+                                                           const double *q,
+                                                           const ClarabelCscMatrix_f64 *A,
+                                                           const double *b,
+                                                           uintptr_t n_cones,
+                                                           const ClarabelSupportedConeT_f64 *cones);
+
+ClarabelDefaultSolver_f32 *clarabel_SolverPool_f32_acquire(ClarabelSolverPool_f32 *pool,
+                                                           const ClarabelCscMatrix_f32 *P,
+                                                           const float *q,
+                                                           const ClarabelCscMatrix_f32 *A,
+                                                           const float *b,
+                                                           uintptr_t n_cones,
+                                                           const ClarabelSupportedConeT_f32 *cones);
+
+static inline ClarabelDefaultSolver *clarabel_SolverPool_acquire(ClarabelSolverPool *pool,
+                                                                 const ClarabelCscMatrix *P,
+                                                                 const ClarabelFloat *q,
+                                                                 const ClarabelCscMatrix *A,
+                                                                 const ClarabelFloat *b,
+                                                                 uintptr_t n_cones,
+                                                                 const ClarabelSupportedConeT *cones)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_SolverPool_f32_acquire(pool, P, q, A, b, n_cones, cones);
+#else
+    return clarabel_SolverPool_f64_acquire(pool, P, q, A, b, n_cones, cones);
+#endif
+}
+
+// As clarabel_SolverPool_acquire, for matrices with 32-bit indices
+ClarabelDefaultSolver_f64 *clarabel_SolverPool_f64_acquire_i32(ClarabelSolverPool_f64 *pool,
+                                                               const ClarabelCscMatrix_f64_i32 *P,
+                                                               const double *q,
+                                                               const ClarabelCscMatrix_f64_i32 *A,
+                                                               const double *b,
+                                                               uintptr_t n_cones,
+                                                               const ClarabelSupportedConeT_f64 *cones);
+
+ClarabelDefaultSolver_f32 *clarabel_SolverPool_f32_acquire_i32(ClarabelSolverPool_f32 *pool,
+                                                               const ClarabelCscMatrix_f32_i32 *P,
+                                                               const float *q,
+                                                               const ClarabelCscMatrix_f32_i32 *A,
+                                                               const float *b,
+                                                               uintptr_t n_cones,
+                                                               const ClarabelSupportedConeT_f32 *cones);
+
+static inline ClarabelDefaultSolver *clarabel_SolverPool_acquire_i32(ClarabelSolverPool *pool,
+                                                                     const ClarabelCscMatrix_i32 *P,
+                                                                     const ClarabelFloat *q,
+                                                                     const ClarabelCscMatrix_i32 *A,
+                                                                     const ClarabelFloat *b,
+                                                                     uintptr_t n_cones,
+                                                                     const ClarabelSupportedConeT *cones)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_SolverPool_f32_acquire_i32(pool, P, q, A, b, n_cones, cones);
+#else
+    return clarabel_SolverPool_f64_acquire_i32(pool, P, q, A, b, n_cones, cones);
+#endif
+}
+
+/// @brief Give a solver back to the pool.  The pool takes ownership and the solver must
+/// not be used afterwards.  Termination callbacks, iteration observers, cancellation
+/// tokens and fixed buffer print targets are detached.  Solvers not handed out by this pool, solvers that do
+/// not allow data updates, and solvers beyond max_idle are freed instead.
+void clarabel_SolverPool_f64_release(ClarabelSolverPool_f64 *pool, ClarabelDefaultSolver_f64 *solver);
+
+void clarabel_SolverPool_f32_release(ClarabelSolverPool_f32 *pool, ClarabelDefaultSolver_f32 *solver);
+
+static inline void clarabel_SolverPool_release(ClarabelSolverPool *pool, ClarabelDefaultSolver *solver)
+{
+#ifdef CLARABEL_USE_FLOAT
+    clarabel_SolverPool_f32_release(pool, solver);
+#else
+    clarabel_SolverPool_f64_release(pool, solver);
+#endif
+}
+
+/// @brief Number of released solvers currently held for reuse
+uintptr_t clarabel_SolverPool_f64_idle_count(ClarabelSolverPool_f64 *pool);
+
+uintptr_t clarabel_SolverPool_f32_idle_count(ClarabelSolverPool_f32 *pool);
+
+static inline uintptr_t clarabel_SolverPool_idle_count(ClarabelSolverPool *pool)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_SolverPool_f32_idle_count(pool);
+#else
+    return clarabel_SolverPool_f64_idle_count(pool);
+#endif
+}
+
+#endif /* CLARABEL_SOLVER_POOL_H */
@@ -0,0 +1,99 @@
+#ifndef CLARABEL_STRUCTURE_HASH_H
+#define CLARABEL_STRUCTURE_HASH_H
+
+#include "ClarabelTypes.h"
+#include "CscMatrix.h"
+#include "SupportedConeT.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Problem structure APIs
+//
+// The structure of a problem is the dimensions and sparsity patterns of P and A and the
+// list of cones, including cone parameters such as power cone exponents.  Numeric values
+// in P, A, q and b are ignored.  The hash is computed over the index values widened to
+// 64 bits, so it is the same for 32-bit and native index matrices, on every platform and
+// across releases, and it is the key used by ClarabelSolverPool.
+
+/// @brief Stable 64-bit fingerprint of the structure of a problem
+///
+/// @param P Upper triangular matrix in CSC format
+/// @param A Constraint matrix in CSC format
+/// @param n_cones Number of cones
+/// @param cones Array of cones
+uint64_t clarabel_structure_hash_f64(const ClarabelCscMatrix_f64 *P,
+                                     const ClarabelCscMatrix_f64 *A,
+                                     uintptr_t n_cones,
+                                     const ClarabelSupportedConeT_f64 *cones);
+
+uint64_t clarabel_structure_hash_f32(const ClarabelCscMatrix_f32 *P,
+                                     const ClarabelCscMatrix_f32 *A,
+                                     uintptr_t n_cones,
+                                     const ClarabelSupportedConeT_f32 *cones);
+
+static inline uint64_t clarabel_structure_hash(const ClarabelCscMatrix *P,
+                                               const ClarabelCscMatrix *A,
+                                               uintptr_t n_cones,
+                                               const ClarabelSupportedConeT *cones)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_structure_hash_f32(P, A, n_cones, cones);
+#else
+    return clarabel_structure_hash_f64(P, A, n_cones, cones);
+#endif
+}
+
+// As clarabel_structure_hash, for matrices with 32-bit indices
+uint64_t clarabel_structure_hash_f64_i32(const ClarabelCscMatrix_f64_i32 *P,
+                                         const ClarabelCscMatrix_f64_i32 *A,
+                                         uintptr_t n_cones,
+                                         const ClarabelSupportedConeT_f64 *cones);
+
+uint64_t clarabel_structure_hash_f32_i32(const ClarabelCscMatrix_f32_i32 *P,
+                                         const ClarabelCscMatrix_f32_i32 *A,
+                                         uintptr_t n_cones,
+                                         const ClarabelSupportedConeT_f32 *cones);
+
+static inline uint64_t clarabel_structure_hash_i32(const ClarabelCscMatrix_i32 *P,
+                                                   const ClarabelCscMatrix_i32 *A,
+                                                   uintptr_t n_cones,
+                                                   const ClarabelSupportedConeT *cones)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_structure_hash_f32_i32(P, A, n_cones, cones);
+#else
+    return clarabel_structure_hash_f64_i32(P, A, n_cones, cones);
+#endif
+}
+
+/// @brief True if two matrices have the same dimensions and sparsity pattern.  Matrices
+/// with the same pattern can be passed to clarabel_DefaultSolver_update_P_csc and
+/// clarabel_DefaultSolver_update_A_csc, which then update the values only.
+bool clarabel_CscMatrix_f64_same_pattern(const ClarabelCscMatrix_f64 *A, const ClarabelCscMatrix_f64 *B);
+
+bool clarabel_CscMatrix_f32_same_pattern(const ClarabelCscMatrix_f32 *A, const ClarabelCscMatrix_f32 *B);
+
+static inline bool clarabel_CscMatrix_same_pattern(const ClarabelCscMatrix *A, const ClarabelCscMatrix *B)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_CscMatrix_f32_same_pattern(A, B);
+#else
+    return clarabel_CscMatrix_f64_same_pattern(A, B);
+#endif
+}
+
+bool clarabel_CscMatrix_f64_i32_same_pattern(const ClarabelCscMatrix_f64_i32 *A, const ClarabelCscMatrix_f64_i32 *B);
+
+bool clarabel_CscMatrix_f32_i32_same_pattern(const ClarabelCscMatrix_f32_i32 *A, const ClarabelCscMatrix_f32_i32 *B);
+
+static inline bool clarabel_CscMatrix_i32_same_pattern(const ClarabelCscMatrix_i32 *A, const ClarabelCscMatrix_i32 *B)
+{
+#ifdef CLARABEL_USE_FLOAT
+    return clarabel_CscMatrix_f32_i32_same_pattern(A, B);
+#else
+    return clarabel_CscMatrix_f64_i32_same_pattern(A, B);
+#endif
+}
+
+#endif /* CLARABEL_STRUCTURE_HASH_H */
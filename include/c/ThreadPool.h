@@ -0,0 +1,31 @@
+#ifndef CLARABEL_THREAD_POOL_H
+#define CLARABEL_THREAD_POOL_H
+
+#include <stdint.h>
+
+// Process-wide thread settings
+//
+// The global thread count bounds the worker threads shared by all asynchronous solves
+// and is the default thread count of batch solves.  The solver thread budget is the
+// max_threads given to the linear solver of each solver built while it is set, when the
+// solver's settings leave max_threads at 0.  The linear solver takes its thread count
+// when the solver is built, so the budget cannot be changed for an existing solver.  A
+// solver loaded from a JSON file without settings keeps the max_threads saved in the file.
+// Together they bound the threads used by overlapping solves to about
+// global thread count x solver thread budget.  All functions may be called from any
+// thread.
+
+/// @brief Set the global thread count.  Use 0 for one thread per available core, the
+/// default.  Workers above a lowered count retire after their current solve.
+void clarabel_set_global_thread_pool(uintptr_t n_threads);
+
+/// @brief The global thread count in effect
+uintptr_t clarabel_global_thread_pool(void);
+
+/// @brief Set max_threads for solvers built afterwards whose settings have max_threads = 0.
+/// Use 0, the default, to leave the choice to the linear solver.
+void clarabel_set_solver_thread_budget(uint32_t max_threads);
+
+uint32_t clarabel_solver_thread_budget(void);
+
+#endif /* CLARABEL_THREAD_POOL_H */
@@ -6,6 +6,12 @@
 #include "c/DefaultInfo.h"
 #include "c/DefaultSolution.h"
 #include "c/DefaultSolver.h"
+#include "c/LdlSolver.h"
+#include "c/BatchSolver.h"
+#include "c/CancelToken.h"
+#include "c/SolverPool.h"
+#include "c/StructureHash.h"
 #include "c/SupportedConeT.h"
+#include "c/ThreadPool.h"
 
 #endif  // CLARABEL_H
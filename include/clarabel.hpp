@@ -6,6 +6,11 @@
 #include "cpp/DefaultInfo.hpp"
 #include "cpp/DefaultSolution.hpp"
 #include "cpp/DefaultSolver.hpp"
+#include "cpp/LdlSolver.hpp"
+#include "cpp/BatchSolver.hpp"
+#include "cpp/CancelToken.hpp"
+#include "cpp/SolverPool.hpp"
 #include "cpp/SupportedConeT.hpp"
+#include "cpp/ThreadPool.hpp"
 
 #endif  // CLARABEL_H
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "DefaultInfo.hpp"
+#include "DefaultSolver.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace clarabel
+{
+
+extern "C" {
+void clarabel_BatchSolve_f64(const RustDefaultSolverHandle_f64 *solvers,
+                             uintptr_t n_solvers,
+                             uintptr_t n_threads,
+                             DefaultInfo<double> *info);
+void clarabel_BatchSolve_f32(const RustDefaultSolverHandle_f32 *solvers,
+                             uintptr_t n_solvers,
+                             uintptr_t n_threads,
+                             DefaultInfo<float> *info);
+} // extern "C"
+
+// Solves many independent DefaultSolver objects in parallel.
+//
+// The solvers are shared out between the calling thread and the worker threads that also run solve_async, and idle
+// threads pick up the remaining problems until the batch is complete.  Each solver must appear at most once in a
+// batch, and must not be used from any other thread while the batch is being solved.  A solver whose solve fails
+// internally is reported as Unsolved.
+template<typename T = double>
+class BatchSolver
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
+
+  private:
+    uintptr_t n_threads;
+
+    void solve_handles(const std::vector<RustObjectHandle> &handles, DefaultInfo<T> *info) const;
+
+  public:
+    // n_threads bounds the threads working on a batch, the caller included.  0 uses the global thread count, see
+    // set_global_thread_pool, which also bounds the worker threads.
+    explicit BatchSolver(uintptr_t n_threads = 0) : n_threads(n_threads) {}
+
+    uintptr_t threads() const { return n_threads; }
+    void set_threads(uintptr_t n_threads) { this->n_threads = n_threads; }
+
+    // Returns the info of each solver, in the same order as the input
+    std::vector<DefaultInfo<T>> solve(DefaultSolver<T> *const *solvers, size_t n_solvers) const;
+    std::vector<DefaultInfo<T>> solve(const std::vector<DefaultSolver<T> *> &solvers) const;
+    std::vector<DefaultInfo<T>> solve(std::vector<DefaultSolver<T>> &solvers) const;
+};
+
+template<>
+inline void BatchSolver<double>::solve_handles(const std::vector<RustObjectHandle> &handles, DefaultInfo<double> *info) const
+{
+    clarabel_BatchSolve_f64(handles.data(), handles.size(), n_threads, info);
+}
+
+template<>
+inline void BatchSolver<float>::solve_handles(const std::vector<RustObjectHandle> &handles, DefaultInfo<float> *info) const
+{
+    clarabel_BatchSolve_f32(handles.data(), handles.size(), n_threads, info);
+}
+
+template<typename T>
+inline std::vector<DefaultInfo<T>> BatchSolver<T>::solve(DefaultSolver<T> *const *solvers, size_t n_solvers) const
+{
+    std::vector<RustObjectHandle> handles(n_solvers);
+    for (size_t k = 0; k < n_solvers; ++k)
+    {
+        handles[k] = solvers[k]->handle;
+    }
+
+    std::vector<DefaultInfo<T>> info(n_solvers);
+    solve_handles(handles, info.data());
+    return info;
+}
+
+template<typename T>
+inline std::vector<DefaultInfo<T>> BatchSolver<T>::solve(const std::vector<DefaultSolver<T> *> &solvers) const
+{
+    return solve(solvers.data(), solvers.size());
+}
+
+template<typename T>
+inline std::vector<DefaultInfo<T>> BatchSolver<T>::solve(std::vector<DefaultSolver<T>> &solvers) const
+{
+    std::vector<RustObjectHandle> handles(solvers.size());
+    for (size_t k = 0; k < solvers.size(); ++k)
+    {
+        handles[k] = solvers[k].handle;
+    }
+
+    std::vector<DefaultInfo<T>> info(solvers.size());
+    solve_handles(handles, info.data());
+    return info;
+}
+
+} // namespace clarabel
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+
+namespace clarabel
+{
+
+using RustCancelTokenHandle = const void *;
+
+extern "C" {
+RustCancelTokenHandle clarabel_CancelToken_new();
+void clarabel_CancelToken_free(RustCancelTokenHandle token);
+void clarabel_CancelToken_cancel(RustCancelTokenHandle token);
+void clarabel_CancelToken_reset(RustCancelTokenHandle token);
+bool clarabel_CancelToken_is_cancelled(RustCancelTokenHandle token);
+void clarabel_CancelToken_set_deadline(RustCancelTokenHandle token, double seconds);
+void clarabel_CancelToken_clear_deadline(RustCancelTokenHandle token);
+} // extern "C"
+
+// Cooperative cancellation flag and deadline for solves.
+//
+// Solvers the token is attached to with DefaultSolver::set_cancel_token poll it at every iteration boundary and stop
+// with SolverStatus::CallbackTerminated once it is cancelled or its deadline has passed.  Cancellation is sticky until
+// reset().  A token may be shared by many solvers, and all methods may be called from any thread while they run.
+// Attached solvers keep the token alive, so it may be destroyed before them.
+class CancelToken
+{
+  private:
+    RustCancelTokenHandle handle = nullptr;
+
+    template<typename T>
+    friend class DefaultSolver;
+
+  public:
+    CancelToken() : handle(clarabel_CancelToken_new()) {}
+    ~CancelToken()
+    {
+        if (handle != nullptr)
+        {
+            clarabel_CancelToken_free(handle);
+        }
+    }
+
+    CancelToken(const CancelToken &) = delete;
+    CancelToken &operator=(const CancelToken &) = delete;
+    CancelToken(CancelToken &&other) : handle(other.handle) { other.handle = nullptr; }
+    CancelToken &operator=(CancelToken &&other)
+    {
+        if (this != &other)
+        {
+            if (handle != nullptr)
+            {
+                clarabel_CancelToken_free(handle);
+            }
+            handle = other.handle;
+            other.handle = nullptr;
+        }
+        return *this;
+    }
+
+    void cancel() const { clarabel_CancelToken_cancel(handle); }
+
+    // clears both the cancellation flag and the deadline
+    void reset() const { clarabel_CancelToken_reset(handle); }
+
+    // true once cancelled or past the deadline
+    bool cancelled() const { return clarabel_CancelToken_is_cancelled(handle); }
+
+    // deadline in seconds from now, replacing any earlier one
+    void set_deadline(double seconds) const { clarabel_CancelToken_set_deadline(handle, seconds); }
+
+    void set_deadline(std::chrono::steady_clock::time_point deadline) const
+    {
+        std::chrono::duration<double> remaining = deadline - std::chrono::steady_clock::now();
+        set_deadline(remaining.count());
+    }
+
+    void clear_deadline() const { clarabel_CancelToken_clear_deadline(handle); }
+};
+
+} // namespace clarabel
@@ -23,4 +23,22 @@ struct CscMatrix
     }
 };
 
+// CSC matrix with 32-bit indices, widened once inside the solver
+template<typename T = double>
+struct CscMatrix32
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
+
+    uintptr_t m;
+    uintptr_t n;
+    const int32_t *colptr;
+    const int32_t *rowval;
+    const T *nzval;
+
+    CscMatrix32(uintptr_t _m, uintptr_t _n, const int32_t *_colptr, const int32_t *_rowval, const T *_nzval)
+        : m(_m), n(_n), colptr(_colptr), rowval(_rowval), nzval(_nzval)
+    {
+    }
+};
+
 } // namespace clarabel
\ No newline at end of file
@@ -43,6 +43,73 @@ struct DefaultInfo
     // NB : `PrintStream stream` not passed to C++ API
 };
 
+// Wall clock timings (seconds) and counters accumulated over the lifetime of a solver
+struct DefaultTimings
+{
+    double setup_time;      // presolve, equilibration, KKT assembly and factorisation
+    double solve_time;      // total time spent in solve()
+    double last_solve_time; // time spent in the most recent solve()
+    double update_time;     // total time spent in data updates
+    uint32_t solve_count;
+    uint32_t update_count;
+    uint32_t iterations;    // total IP iterations, one numeric KKT factorisation each
+    uint32_t symbolic_count; // symbolic KKT analyses: one per build, carried over by clones
+};
+
+// Progress record written once per iteration by the iteration observer
+template<typename T = double>
+struct IterationRecord
+{
+    double elapsed; // seconds since the start of the current solve
+    uint32_t iteration;
+    T mu;
+    T sigma;
+    T step_length;
+    T cost_primal;
+    T cost_dual;
+    T res_primal;
+    T res_dual;
+    T res_primal_inf;
+    T res_dual_inf;
+    T gap_abs;
+    T gap_rel;
+    T ktratio;
+};
+
+// Caller-owned ring buffer for iteration records.  Record k of the solver's lifetime is written to
+// records[k % capacity], after which head is set to k+1 with release ordering.  A slot holds record k only until
+// record k + capacity overwrites it, with no check on readers, so during a solve a copy of record k is intact only
+// if load_head() called after taking the copy returns less than k + capacity.  While a solve may be running, read
+// head only through load_head(), which loads it with acquire ordering so that the records below it are complete
+// and after the caller's earlier reads of records, and leave records and capacity unchanged.  head is updated
+// atomically and is aligned to 8 bytes, which uint64_t members are not on some 32-bit targets.
+template<typename T = double>
+struct IterationRing
+{
+    IterationRecord<T> *records;
+    uintptr_t capacity;
+    alignas(8) uint64_t head;
+
+    uint64_t load_head() const;
+};
+
+extern "C" {
+uint64_t clarabel_IterationRing_f64_load_head(const IterationRing<double> *ring);
+uint64_t clarabel_IterationRing_f32_load_head(const IterationRing<float> *ring);
+} // extern "C"
+
+template<>
+inline uint64_t IterationRing<double>::load_head() const
+{
+    return clarabel_IterationRing_f64_load_head(this);
+}
+
+template<>
+inline uint64_t IterationRing<float>::load_head() const
+{
+    return clarabel_IterationRing_f32_load_head(this);
+}
+
 // Instantiate the templates
 template struct DefaultInfo<double>;
 template struct DefaultInfo<float>;
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace clarabel
 {
@@ -377,9 +379,40 @@ class DefaultSettingsBuilder
 
 };
 
+// Settings converted and validated once on the Rust side, for constructing many solvers with the same settings.
+// Throws std::invalid_argument if the settings are invalid.
+template<typename T = double>
+class DefaultSettingsHandle
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
+
+  private:
+    void *handle = nullptr;
+
+  public:
+    explicit DefaultSettingsHandle(const DefaultSettings<T> &settings);
+    ~DefaultSettingsHandle();
+
+    DefaultSettingsHandle(const DefaultSettingsHandle &) = delete;
+    DefaultSettingsHandle(DefaultSettingsHandle &&other) : handle(other.handle) { other.handle = nullptr; }
+    DefaultSettingsHandle &operator=(const DefaultSettingsHandle &) = delete;
+    DefaultSettingsHandle &operator=(DefaultSettingsHandle &&other)
+    {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+
+    const void *get() const { return handle; }
+};
+
 extern "C" {
 DefaultSettings<double> clarabel_DefaultSettings_f64_default();
 DefaultSettings<float> clarabel_DefaultSettings_f32_default();
+
+void *clarabel_DefaultSettings_f64_compile(const DefaultSettings<double> *settings);
+void *clarabel_DefaultSettings_f32_compile(const DefaultSettings<float> *settings);
+void clarabel_DefaultSettings_f64_free_handle(void *handle);
+void clarabel_DefaultSettings_f32_free_handle(void *handle);
 }
 
 template<>
@@ -394,4 +427,36 @@ inline DefaultSettings<float> DefaultSettings<float>::default_settings()
     return clarabel_DefaultSettings_f32_default();
 }
 
+template<>
+inline DefaultSettingsHandle<double>::DefaultSettingsHandle(const DefaultSettings<double> &settings)
+    : handle(clarabel_DefaultSettings_f64_compile(&settings))
+{
+    if (handle == nullptr)
+    {
+        throw std::invalid_argument("Invalid solver settings");
+    }
+}
+
+template<>
+inline DefaultSettingsHandle<float>::DefaultSettingsHandle(const DefaultSettings<float> &settings)
+    : handle(clarabel_DefaultSettings_f32_compile(&settings))
+{
+    if (handle == nullptr)
+    {
+        throw std::invalid_argument("Invalid solver settings");
+    }
+}
+
+template<>
+inline DefaultSettingsHandle<double>::~DefaultSettingsHandle()
+{
+    clarabel_DefaultSettings_f64_free_handle(handle);
+}
+
+template<>
+inline DefaultSettingsHandle<float>::~DefaultSettingsHandle()
+{
+    clarabel_DefaultSettings_f32_free_handle(handle);
+}
+
 } // namespace clarabel
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "CancelToken.hpp"
 #include "CscMatrix.hpp"
 #include "DefaultInfo.hpp"
 #include "DefaultSettings.hpp"
@@ -7,7 +8,12 @@
 #include "SupportedConeT.hpp"
 
 #include <Eigen/Eigen>
+#include <cstdint>
+#include <exception>
+#include <future>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace clarabel
@@ -17,47 +23,169 @@ using RustObjectHandle = void *;
 using RustDefaultSolverHandle_f64 = RustObjectHandle;
 using RustDefaultSolverHandle_f32 = RustObjectHandle;
 
+template<typename T>
+class BatchSolver;
+
+template<typename T>
+class SolverPool;
+
+template<typename T>
+class LdlSolver;
+
 template<typename T = double>
 class DefaultSolver
 {
     static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
 
   private:
-    struct ConvertedCscMatrix;
+    template<typename Index>
+    struct ConvertedCsc;
+    using ConvertedCscMatrix = ConvertedCsc<uintptr_t>;
+    using ConvertedCscMatrix32 = ConvertedCsc<int32_t>;
+    friend class BatchSolver<T>;
+    friend class SolverPool<T>;
+    friend class LdlSolver<T>;
 
     RustObjectHandle handle = nullptr;
 
-    // Helper function for converting a Eigen sparse matrix into a temporary object of type ConvertedCscMatrix<T>
+    // Identity of the sparse matrix last passed for P or A.  A compressed matrix with the same index storage,
+    // dimensions and number of nonzeros is taken to have an unchanged pattern, so that updating it sends only its
+    // values.  The indices themselves are not read.
+    struct PatternKey
+    {
+        const void *outer = nullptr;
+        const void *inner = nullptr;
+        Eigen::Index rows = 0;
+        Eigen::Index cols = 0;
+        Eigen::Index nnz = 0;
+
+        template<typename StorageIndex>
+        static PatternKey of(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix)
+        {
+            PatternKey key;
+            if (!matrix.isCompressed() || matrix.nonZeros() == 0)
+            {
+                return key;
+            }
+            key.outer = matrix.outerIndexPtr();
+            key.inner = matrix.innerIndexPtr();
+            key.rows = matrix.rows();
+            key.cols = matrix.cols();
+            key.nnz = matrix.nonZeros();
+            return key;
+        }
+
+        bool matches(const PatternKey &other) const
+        {
+            return outer != nullptr && outer == other.outer && inner == other.inner && rows == other.rows &&
+                   cols == other.cols && nnz == other.nnz;
+        }
+    };
+
+    PatternKey pattern_P;
+    PatternKey pattern_A;
+
+    // Conversion paths from an Eigen StorageIndex to the index type passed to Rust
+    struct native_index {};  // same width as uintptr_t: borrowed as is
+    struct int32_index {};   // signed 32-bit (Eigen's default): borrowed and widened once in Rust
+    struct widened_index {}; // anything else: widened into temporary copies here
+
+    template<typename StorageIndex>
+    using index_path = typename std::conditional<
+        std::is_integral<StorageIndex>::value && sizeof(StorageIndex) == sizeof(uintptr_t),
+        native_index,
+        typename std::conditional<std::is_integral<StorageIndex>::value && std::is_signed<StorageIndex>::value &&
+                                      sizeof(StorageIndex) == sizeof(int32_t),
+                                  int32_index,
+                                  widened_index>::type>::type;
+
+    template<typename StorageIndex>
+    using ConvertedFor = typename std::conditional<std::is_same<index_path<StorageIndex>, int32_index>::value,
+                                                   ConvertedCscMatrix32,
+                                                   ConvertedCscMatrix>::type;
+
+    // Helper function for converting a Eigen sparse matrix into a temporary object of type ConvertedCsc
     // The temporary object is used to provide the problem data for constructing the solver.
-    static ConvertedCscMatrix eigen_sparse_to_clarabel(const Eigen::SparseMatrix<T, Eigen::ColMajor> &matrix)
+    // The conversion path is selected at compile time from the StorageIndex of the matrix.
+    template<typename StorageIndex>
+    static ConvertedFor<StorageIndex> eigen_sparse_to_clarabel(
+        const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix)
     {
-        // Make a copy of data in SparseMatrix to convert StorageIndex to uintptr_t
-        std::vector<uintptr_t> row_indices(matrix.nonZeros());
-        std::vector<uintptr_t> col_pointers(matrix.outerSize() + 1);
+        return eigen_sparse_to_clarabel(matrix, index_path<StorageIndex>());
+    }
 
-        // Convert to uintptr_t
-        for (int k = 0; k < matrix.nonZeros(); ++k)
+    // Native index width: borrow the index arrays of the compressed matrix directly
+    template<typename StorageIndex>
+    static ConvertedCscMatrix eigen_sparse_to_clarabel(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix,
+                                                       native_index)
+    {
+        if (!matrix.isCompressed())
         {
-            row_indices[k] = matrix.innerIndexPtr()[k];
+            return copy_indices<uintptr_t>(matrix);
         }
-        for (int k = 0; k < matrix.outerSize(); ++k)
+
+        const T *nzval_ptr = matrix.nonZeros() == 0 ? nullptr : matrix.valuePtr();
+
+        return ConvertedCscMatrix(static_cast<uintptr_t>(matrix.rows()), static_cast<uintptr_t>(matrix.cols()),
+                                  reinterpret_cast<const uintptr_t *>(matrix.outerIndexPtr()),
+                                  reinterpret_cast<const uintptr_t *>(matrix.innerIndexPtr()), nzval_ptr);
+    }
+
+    // 32-bit indices: borrow the index arrays of the compressed matrix, Rust widens them while reading
+    template<typename StorageIndex>
+    static ConvertedCscMatrix32 eigen_sparse_to_clarabel(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix,
+                                                         int32_index)
+    {
+        if (!matrix.isCompressed())
         {
-            col_pointers[k] = matrix.outerIndexPtr()[k];
+            return copy_indices<int32_t>(matrix);
         }
-        col_pointers[matrix.outerSize()] = matrix.nonZeros();
 
-        // No conversion needed for nz values
         const T *nzval_ptr = matrix.nonZeros() == 0 ? nullptr : matrix.valuePtr();
 
-        ConvertedCscMatrix csc_matrix(static_cast<uintptr_t>(matrix.rows()), static_cast<uintptr_t>(matrix.cols()),
-                                      std::move(col_pointers), std::move(row_indices), nzval_ptr);
+        return ConvertedCscMatrix32(static_cast<uintptr_t>(matrix.rows()), static_cast<uintptr_t>(matrix.cols()),
+                                    reinterpret_cast<const int32_t *>(matrix.outerIndexPtr()),
+                                    reinterpret_cast<const int32_t *>(matrix.innerIndexPtr()), nzval_ptr);
+    }
+
+    // Any other index width: widen the index arrays into temporary copies
+    template<typename StorageIndex>
+    static ConvertedCscMatrix eigen_sparse_to_clarabel(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix,
+                                                       widened_index)
+    {
+        return copy_indices<uintptr_t>(matrix);
+    }
+
+    // Copy the index arrays into temporary arrays of type Index
+    template<typename Index, typename StorageIndex>
+    static ConvertedCsc<Index> copy_indices(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &matrix)
+    {
+        // Make a copy of data in SparseMatrix to convert StorageIndex to Index
+        std::vector<Index> row_indices(matrix.nonZeros());
+        std::vector<Index> col_pointers(matrix.outerSize() + 1);
+
+        // Convert to Index
+        for (Eigen::Index k = 0; k < matrix.nonZeros(); ++k)
+        {
+            row_indices[k] = static_cast<Index>(matrix.innerIndexPtr()[k]);
+        }
+        for (Eigen::Index k = 0; k < matrix.outerSize(); ++k)
+        {
+            col_pointers[k] = static_cast<Index>(matrix.outerIndexPtr()[k]);
+        }
+        col_pointers[matrix.outerSize()] = static_cast<Index>(matrix.nonZeros());
+
+        // No conversion needed for nz values
+        const T *nzval_ptr = matrix.nonZeros() == 0 ? nullptr : matrix.valuePtr();
 
-        return std::move(csc_matrix);
+        return ConvertedCsc<Index>(static_cast<uintptr_t>(matrix.rows()), static_cast<uintptr_t>(matrix.cols()),
+                                   std::move(col_pointers), std::move(row_indices), nzval_ptr);
     }
 
-    static void check_dimensions(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P,
+    template<typename StorageIndex>
+    static void check_dimensions(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
                                  const Eigen::Ref<const Eigen::VectorX<T>> &q,
-                                 const Eigen::SparseMatrix<T, Eigen::ColMajor> &A,
+                                 const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
                                  const Eigen::Ref<const Eigen::VectorX<T>> &b,
                                  const std::vector<SupportedConeT<T>> &cones)
     {
@@ -92,6 +220,100 @@ class DefaultSolver
         }
     }
 
+    template<typename StorageIndex, typename Settings>
+    void init(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+              const Eigen::Ref<Eigen::VectorX<T>> &q,
+              const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+              const Eigen::Ref<Eigen::VectorX<T>> &b,
+              const std::vector<SupportedConeT<T>> &cones,
+              const Settings &settings);
+
+    // Calls into the typed Rust API with matrices that have already been converted
+    static RustObjectHandle create_handle(const ConvertedCscMatrix &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const DefaultSettings<T> &settings);
+    static RustObjectHandle create_handle(const ConvertedCscMatrix32 &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix32 &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const DefaultSettings<T> &settings);
+    static RustObjectHandle create_handle(const ConvertedCscMatrix32 &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix32 &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const DefaultSettingsHandle<T> &settings);
+    static RustObjectHandle create_handle(const ConvertedCscMatrix &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const DefaultSettingsHandle<T> &settings);
+    // Settings for a solver that keeps a copy of its problem data, see with_problem_data
+    struct KeepProblemData
+    {
+        const DefaultSettings<T> &settings;
+    };
+    static RustObjectHandle create_handle(const ConvertedCscMatrix &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const KeepProblemData &settings);
+    static RustObjectHandle create_handle(const ConvertedCscMatrix32 &P,
+                                          const T *q,
+                                          const ConvertedCscMatrix32 &A,
+                                          const T *b,
+                                          const std::vector<SupportedConeT<T>> &cones,
+                                          const KeepProblemData &settings);
+
+    template<typename StorageIndex>
+    DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                  const Eigen::Ref<Eigen::VectorX<T>> &q,
+                  const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                  const Eigen::Ref<Eigen::VectorX<T>> &b,
+                  const std::vector<SupportedConeT<T>> &cones,
+                  const KeepProblemData &settings);
+
+    void update_P_csc(const ConvertedCscMatrix &P);
+    void update_P_csc(const ConvertedCscMatrix32 &P);
+    void update_A_csc(const ConvertedCscMatrix &A);
+    void update_A_csc(const ConvertedCscMatrix32 &A);
+    static uint64_t hash_structure(const ConvertedCscMatrix &P,
+                                   const ConvertedCscMatrix &A,
+                                   const std::vector<SupportedConeT<T>> &cones);
+    static uint64_t hash_structure(const ConvertedCscMatrix32 &P,
+                                   const ConvertedCscMatrix32 &A,
+                                   const std::vector<SupportedConeT<T>> &cones);
+    static bool compare_patterns(const ConvertedCscMatrix &A, const ConvertedCscMatrix &B);
+    static bool compare_patterns(const ConvertedCscMatrix32 &A, const ConvertedCscMatrix32 &B);
+
+    enum class DataField { P, A, q, b };
+    bool update_sorted(DataField field, const uintptr_t *index, const T *values, uintptr_t nvals);
+    bool update_sorted(DataField field, const int32_t *index, const T *values, uintptr_t nvals);
+    template<typename Index>
+    void update_sorted_checked(DataField field, const Index *index, const T *values, uintptr_t nvals);
+
+    static void complete_async(RustObjectHandle solver, const DefaultInfo<T> *info, void *userdata);
+    void solve_async_handle(void *promise);
+    bool copy_solution(T *x, uintptr_t n, T *z, T *s, uintptr_t m) const;
+
+    bool backward_impl(const T *dx,
+                       const T *dz,
+                       const T *ds,
+                       T *dP,
+                       uintptr_t nnzP,
+                       T *dq,
+                       uintptr_t n,
+                       T *dA,
+                       uintptr_t nnzA,
+                       T *db,
+                       uintptr_t m);
+
   public:
     // Lifetime of problem data: matrices P, A, vectors q, b, cones and the settings are copied when the DefaultSolver
     // object is created in Rust. Eigen::SparseMatrix objects need to be converted to the format supported by Clarabel.
@@ -104,6 +326,48 @@ class DefaultSolver
                   const std::vector<SupportedConeT<T>> &cones,
                   const DefaultSettings<T> &settings);
 
+    // Overload for sparse matrices with a non-default StorageIndex.  When the index type has the same width
+    // as uintptr_t (e.g. int64_t on 64-bit platforms), the index arrays of compressed matrices are passed to
+    // Rust directly and no temporary copies are made.  Signed 32-bit indices, including Eigen's default, are
+    // also passed directly and widened once on the Rust side.
+    template<typename StorageIndex>
+    DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                  const Eigen::Ref<Eigen::VectorX<T>> &q,
+                  const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                  const Eigen::Ref<Eigen::VectorX<T>> &b,
+                  const std::vector<SupportedConeT<T>> &cones,
+                  const DefaultSettings<T> &settings);
+
+    // Overloads taking settings that were converted and validated once, for constructing many solvers
+    DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P,
+                  const Eigen::Ref<Eigen::VectorX<T>> &q,
+                  const Eigen::SparseMatrix<T, Eigen::ColMajor> &A,
+                  const Eigen::Ref<Eigen::VectorX<T>> &b,
+                  const std::vector<SupportedConeT<T>> &cones,
+                  const DefaultSettingsHandle<T> &settings);
+
+    template<typename StorageIndex>
+    DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                  const Eigen::Ref<Eigen::VectorX<T>> &q,
+                  const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                  const Eigen::Ref<Eigen::VectorX<T>> &b,
+                  const std::vector<SupportedConeT<T>> &cones,
+                  const DefaultSettingsHandle<T> &settings);
+
+    // Solver that also keeps a copy of the problem data, kept in step with data updates.  The copy is needed by
+    // clone(), save_binary(), solve_kkt() and backward(); solvers built with the constructors above do not keep
+    // it, so that the problem data is not held twice.
+    template<typename StorageIndex>
+    static DefaultSolver with_problem_data(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                           const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                           const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                           const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                           const std::vector<SupportedConeT<T>> &cones,
+                                           const DefaultSettings<T> &settings)
+    {
+        return DefaultSolver(P, q, A, b, cones, KeepProblemData{ settings });
+    }
+
     DefaultSolver(void* handle);
     ~DefaultSolver();
 
@@ -114,11 +378,90 @@ class DefaultSolver
 
     void solve();
 
+    // Solve on one of the library's worker threads.  The future becomes ready with the info of the solve when it
+    // terminates.  Until then the solver must not be used or destroyed, though the DefaultSolver object may be moved.
+    // A running solve can be stopped early through a CancelToken or a termination callback attached beforehand.
+    // If the solve fails with an internal error, the future holds a std::runtime_error instead.
+    std::future<DefaultInfo<T>> solve_async();
+
+    // Independent solver built from the current problem data and settings.  The setup phase is repeated and
+    // termination callbacks and iteration observers are not copied.  Throws std::runtime_error if the solver does
+    // not hold its problem data, see with_problem_data().
+    DefaultSolver clone() const;
+
+    // Stable fingerprint of the problem structure: the dimensions and sparsity patterns of P and A and the cones,
+    // ignoring all numeric values except cone parameters.  The same for every index type, and equal to the key
+    // SolverPool uses.  See also clarabel::structure_hash.
+    template<typename StorageIndex>
+    static uint64_t structure_hash(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                   const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                   const std::vector<SupportedConeT<T>> &cones)
+    {
+        ConvertedFor<StorageIndex> matrix_P = eigen_sparse_to_clarabel(P);
+        ConvertedFor<StorageIndex> matrix_A = eigen_sparse_to_clarabel(A);
+        return hash_structure(matrix_P, matrix_A, cones);
+    }
+
+    // True if two matrices have the same dimensions and sparsity pattern.  See also clarabel::same_pattern.
+    template<typename StorageIndex>
+    static bool same_pattern(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                             const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &B)
+    {
+        ConvertedFor<StorageIndex> matrix_A = eigen_sparse_to_clarabel(A);
+        ConvertedFor<StorageIndex> matrix_B = eigen_sparse_to_clarabel(B);
+        return compare_patterns(matrix_A, matrix_B);
+    }
+
     // The solution can only be obtained when the solver is in the Solved state, and the DefaultSolution object is only
     // valid when the solver is alive.
     DefaultSolution<T> solution() const;
     DefaultInfo<T> info() const;
 
+    // timings and counters accumulated since construction or the last reset_timings()
+    DefaultTimings timings() const;
+    void reset_timings();
+
+    // Value updates always reuse the symbolic KKT analysis from construction, and update_P / update_A with a sparse
+    // matrix throw std::invalid_argument if its sparsity pattern differs from the solver's.  When the pattern is
+    // locked, solvers made by with_problem_data() also check this against their copy of the data before the solver
+    // sees it.
+    //
+    // When the pattern is not locked, passing the same compressed Eigen matrix object that was last used for P or A
+    // (at construction or in an update) with only its values changed sends just valuePtr() to Rust, without reading
+    // the index arrays.  The matrix is recognised by its index storage, dimensions and number of nonzeros only, so
+    // indices rewritten in place in the same buffers are not noticed; lock the pattern to have every update checked.
+    // Any other matrix goes through the library's pattern comparison.
+    void set_pattern_locked(bool locked);
+    bool pattern_locked() const;
+
+    // Copy the solution directly into caller-owned storage.  x must have length n, and z and s length m, otherwise
+    // std::invalid_argument is thrown and nothing is copied.
+    // The variant taking only x skips the dual and slack vectors.
+    void solution_into(Eigen::Ref<Eigen::VectorX<T>> x, Eigen::Ref<Eigen::VectorX<T>> z, Eigen::Ref<Eigen::VectorX<T>> s) const;
+    void solution_into(Eigen::Ref<Eigen::VectorX<T>> x) const;
+
+    // Solve the KKT system of the last solution, [P A'; A -H] [dx; dz] = rhs, for every column of rhs, e.g. to find
+    // the sensitivity of the solution to q or b.  H is the diagonal of s./z at the solution, zero on equality
+    // constraints.  rhs must have n+m rows.  The factors are kept for further calls until the next solve or data
+    // update.  Only zero and nonnegative cones are supported.  Throws std::runtime_error if the last solve did not
+    // end Solved or AlmostSolved, the data was updated since the last solve, the solver does not hold its problem
+    // data (see with_problem_data()), has other cones, or the system cannot be factored.
+    void solve_kkt(const Eigen::MatrixX<T> &rhs, Eigen::MatrixX<T> &out);
+
+    // Gradients of a loss with respect to the nonzero values of P and A, and to q and b, given its gradients dx, dz
+    // and ds with respect to the solution.  The solution map is differentiated implicitly through the KKT system of
+    // solve_kkt, at the cost of one solve with the factors kept by solve_kkt, factoring if needed.  An off-diagonal
+    // entry of P above the diagonal stands for both of its symmetric positions, and entries below the diagonal, which
+    // the solver does not use, receive zero.  The outputs must have the lengths of the problem data.  Throws std::invalid_argument for
+    // inconsistent lengths and std::runtime_error when solve_kkt would.
+    void backward(const Eigen::Ref<Eigen::VectorX<T>> &dx,
+                  const Eigen::Ref<Eigen::VectorX<T>> &dz,
+                  const Eigen::Ref<Eigen::VectorX<T>> &ds,
+                  Eigen::Ref<Eigen::VectorX<T>> dP,
+                  Eigen::Ref<Eigen::VectorX<T>> dq,
+                  Eigen::Ref<Eigen::VectorX<T>> dA,
+                  Eigen::Ref<Eigen::VectorX<T>> db);
+
     // termination callbacks 
     // -------------------------------
     void set_termination_callback(
@@ -126,35 +469,75 @@ class DefaultSolver
     
     void unset_termination_callback();
 
+    // iteration observer: one IterationRecord per iteration is written into the caller-owned ring, which must stay
+    // valid while attached.  Can be combined with a termination callback.
+    void set_iteration_observer(IterationRing<T> &ring);
+    void unset_iteration_observer();
+
+    // cancellation token: polled at every iteration boundary, see CancelToken.  Can be combined with the above.
+    void set_cancel_token(const CancelToken &token);
+    void unset_cancel_token();
+
 
     // problem data updating functions 
     // ------------------------------- 
 
     // update P 
     void update_P(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P);
+    template<typename StorageIndex>
+    void update_P(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P);
     void update_P(const Eigen::Ref<Eigen::VectorX<T>> &Pnzval);
     void update_P(const T* Pnzval, uintptr_t nnzP);
     void update_P(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
     void update_P(const uintptr_t* index, const T* values, uintptr_t nvals);
 
+    // sorted partial forms: indices must be strictly increasing.  They are validated in one pass and the values
+    // scattered without per-entry checks; std::invalid_argument is thrown if they are unsorted or out of range.
+    void update_P_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_P_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_P_sorted(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_P_sorted(const int32_t* index, const T* values, uintptr_t nvals);
+
     // update A
     void update_A(const Eigen::SparseMatrix<T, Eigen::ColMajor> &A);
+    template<typename StorageIndex>
+    void update_A(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A);
     void update_A(const Eigen::Ref<Eigen::VectorX<T>> &Anzval);
     void update_A(const T* Pnzval, uintptr_t nnzA);
     void update_A(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
     void update_A(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_A_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_A_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_A_sorted(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_A_sorted(const int32_t* index, const T* values, uintptr_t nvals);
 
     // update q
     void update_q(const Eigen::Ref<Eigen::VectorX<T>> &Anzval);
     void update_q(const T* values, uintptr_t nvals);
     void update_q(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
     void update_q(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_q_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_q_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_q_sorted(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_q_sorted(const int32_t* index, const T* values, uintptr_t nvals);
 
     // update b
     void update_b(const Eigen::Ref<Eigen::VectorX<T>> &Anzval);
     void update_b(const T* values, uintptr_t nvals);
     void update_b(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
     void update_b(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_b_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_b_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+    void update_b_sorted(const uintptr_t* index, const T* values, uintptr_t nvals);
+    void update_b_sorted(const int32_t* index, const T* values, uintptr_t nvals);
+
+    // update P, q, A and b with a single call into Rust (full rewrite of each).  Empty vectors and null pointers
+    // leave the corresponding data unchanged.
+    void update_data(const Eigen::Ref<Eigen::VectorX<T>> &Pnzval,
+                     const Eigen::Ref<Eigen::VectorX<T>> &q,
+                     const Eigen::Ref<Eigen::VectorX<T>> &Anzval,
+                     const Eigen::Ref<Eigen::VectorX<T>> &b);
+    void update_data(const T *Pnzval, uintptr_t nnzP, const T *q, uintptr_t n, const T *Anzval, uintptr_t nnzA, const T *b, uintptr_t m);
 
     // Read / write to JSON file 
     #ifdef FEATURE_SERDE
@@ -162,16 +545,32 @@ class DefaultSolver
     static DefaultSolver<T> load_from_file(const std::string &filename);
     #endif
 
+    // Compact binary snapshot of the problem data and settings, for replay with the same build of the library.
+    // Throws std::runtime_error if the file cannot be written or read, or if the solver does not hold its problem
+    // data (see with_problem_data()).  load_binary uses the stored settings unless settings are given.
+    void save_binary(const std::string &filename) const;
+    static DefaultSolver<T> load_binary(const std::string &filename);
+    static DefaultSolver<T> load_binary(const std::string &filename, const DefaultSettings<T> &settings);
+
     // print stream configurations 
     void print_to_stdout();
     void print_to_file(const std::string &filename);
     void print_to_buffer();
     std::string get_print_buffer();
 
+    // Allocation free print targets.  print_to_fixed_buffer writes into caller owned memory, which must
+    // outlive its use by the solver, and drops output beyond the capacity.  fixed_buffer_len returns the
+    // bytes written so far.  print_to_callback passes each chunk of output (not null terminated) to the
+    // callback.
+    void print_to_fixed_buffer(char *buffer, uintptr_t capacity);
+    uintptr_t fixed_buffer_len();
+    void print_to_callback(void (*callback)(const char *, uintptr_t, void *), void *userdata);
+
 };
 
 template<typename T>
-DefaultSolver<T>::DefaultSolver(DefaultSolver &&other) : handle(other.handle)
+DefaultSolver<T>::DefaultSolver(DefaultSolver &&other)
+    : handle(other.handle), pattern_P(other.pattern_P), pattern_A(other.pattern_A)
 {
     other.handle = nullptr;
 }
@@ -181,25 +580,44 @@ DefaultSolver<T> &DefaultSolver<T>::operator=(DefaultSolver &&other)
 {
     if (this != &other){
         handle = other.handle;
+        pattern_P = other.pattern_P;
+        pattern_A = other.pattern_A;
         other.handle = nullptr;
     }
     return *this;
 }
 
 template<typename T>
-struct DefaultSolver<T>::ConvertedCscMatrix
+template<typename Index>
+struct DefaultSolver<T>::ConvertedCsc
 {
+    using Csc = typename std::conditional<std::is_same<Index, int32_t>::value, CscMatrix32<T>, CscMatrix<T>>::type;
+
     uintptr_t m;
     uintptr_t n;
-    const std::vector<uintptr_t> colptr;
-    const std::vector<uintptr_t> rowval;
+    // Copies of the index arrays.  These are empty when the index arrays are borrowed from the source matrix.
+    std::vector<Index> colptr_storage;
+    std::vector<Index> rowval_storage;
+    const Index *colptr;
+    const Index *rowval;
     const T *nzval;
 
-    ConvertedCscMatrix(
-        uintptr_t m, uintptr_t n, std::vector<uintptr_t> &&colptr, std::vector<uintptr_t> &&rowval, const T *nzval)
-        : m(m), n(n), colptr(std::move(colptr)), rowval(std::move(rowval)), nzval(nzval)
+    ConvertedCsc(uintptr_t m, uintptr_t n, std::vector<Index> &&colptr, std::vector<Index> &&rowval, const T *nzval)
+        : m(m), n(n), colptr_storage(std::move(colptr)), rowval_storage(std::move(rowval)),
+          colptr(colptr_storage.data()), rowval(rowval_storage.data()), nzval(nzval)
+    {
+    }
+
+    ConvertedCsc(uintptr_t m, uintptr_t n, const Index *colptr, const Index *rowval, const T *nzval)
+        : m(m), n(n), colptr(colptr), rowval(rowval), nzval(nzval)
     {
     }
+
+    // Moving the storage vectors keeps their heap buffers, so the borrowed pointers remain valid
+    ConvertedCsc(ConvertedCsc &&other) = default;
+    ConvertedCsc(const ConvertedCsc &) = delete;
+
+    Csc as_csc() const { return Csc(m, n, colptr, rowval, nzval); }
 };
 
 extern "C" {
@@ -219,9 +637,96 @@ RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new(const CscMatrix<float
                                                            const SupportedConeT<float> *cones,
                                                            const DefaultSettings<float> *settings);
 
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_new_i32(const CscMatrix32<double> *P,
+                                                               const double *q,
+                                                               const CscMatrix32<double> *A,
+                                                               const double *b,
+                                                               uintptr_t n_cones,
+                                                               const SupportedConeT<double> *cones,
+                                                               const DefaultSettings<double> *settings);
+
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new_i32(const CscMatrix32<float> *P,
+                                                               const float *q,
+                                                               const CscMatrix32<float> *A,
+                                                               const float *b,
+                                                               uintptr_t n_cones,
+                                                               const SupportedConeT<float> *cones,
+                                                               const DefaultSettings<float> *settings);
+
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_new_keep_data(const CscMatrix<double> *P,
+                                                                     const double *q,
+                                                                     const CscMatrix<double> *A,
+                                                                     const double *b,
+                                                                     uintptr_t n_cones,
+                                                                     const SupportedConeT<double> *cones,
+                                                                     const DefaultSettings<double> *settings);
+
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new_keep_data(const CscMatrix<float> *P,
+                                                                     const float *q,
+                                                                     const CscMatrix<float> *A,
+                                                                     const float *b,
+                                                                     uintptr_t n_cones,
+                                                                     const SupportedConeT<float> *cones,
+                                                                     const DefaultSettings<float> *settings);
+
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_new_i32_keep_data(const CscMatrix32<double> *P,
+                                                                         const double *q,
+                                                                         const CscMatrix32<double> *A,
+                                                                         const double *b,
+                                                                         uintptr_t n_cones,
+                                                                         const SupportedConeT<double> *cones,
+                                                                         const DefaultSettings<double> *settings);
+
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new_i32_keep_data(const CscMatrix32<float> *P,
+                                                                         const float *q,
+                                                                         const CscMatrix32<float> *A,
+                                                                         const float *b,
+                                                                         uintptr_t n_cones,
+                                                                         const SupportedConeT<float> *cones,
+                                                                         const DefaultSettings<float> *settings);
+
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_new_with_settings_handle(const CscMatrix<double> *P,
+                                                                                const double *q,
+                                                                                const CscMatrix<double> *A,
+                                                                                const double *b,
+                                                                                uintptr_t n_cones,
+                                                                                const SupportedConeT<double> *cones,
+                                                                                const void *settings);
+
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new_with_settings_handle(const CscMatrix<float> *P,
+                                                                                const float *q,
+                                                                                const CscMatrix<float> *A,
+                                                                                const float *b,
+                                                                                uintptr_t n_cones,
+                                                                                const SupportedConeT<float> *cones,
+                                                                                const void *settings);
+
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_new_i32_with_settings_handle(const CscMatrix32<double> *P,
+                                                                                    const double *q,
+                                                                                    const CscMatrix32<double> *A,
+                                                                                    const double *b,
+                                                                                    uintptr_t n_cones,
+                                                                                    const SupportedConeT<double> *cones,
+                                                                                    const void *settings);
+
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_new_i32_with_settings_handle(const CscMatrix32<float> *P,
+                                                                                    const float *q,
+                                                                                    const CscMatrix32<float> *A,
+                                                                                    const float *b,
+                                                                                    uintptr_t n_cones,
+                                                                                    const SupportedConeT<float> *cones,
+                                                                                    const void *settings);
+
 void clarabel_DefaultSolver_f64_solve(RustDefaultSolverHandle_f64 solver);
 void clarabel_DefaultSolver_f32_solve(RustDefaultSolverHandle_f32 solver);
 
+void clarabel_DefaultSolver_f64_solve_async(RustDefaultSolverHandle_f64 solver,
+                                            void (*completion)(RustDefaultSolverHandle_f64, const DefaultInfo<double> *, void *),
+                                            void *userdata);
+void clarabel_DefaultSolver_f32_solve_async(RustDefaultSolverHandle_f32 solver,
+                                            void (*completion)(RustDefaultSolverHandle_f32, const DefaultInfo<float> *, void *),
+                                            void *userdata);
+
 void clarabel_DefaultSolver_f64_free(RustDefaultSolverHandle_f64 solver);
 void clarabel_DefaultSolver_f32_free(RustDefaultSolverHandle_f32 solver);
 
@@ -229,25 +734,78 @@ DefaultSolution<double>::ClarabelDefaultSolution
 clarabel_DefaultSolver_f64_solution(RustDefaultSolverHandle_f64 solver);
 DefaultSolution<float>::ClarabelDefaultSolution clarabel_DefaultSolver_f32_solution(RustDefaultSolverHandle_f32 solver);
 
+bool clarabel_DefaultSolver_f64_copy_solution(
+    RustDefaultSolverHandle_f64 solver, double *x, uintptr_t n, double *z, double *s, uintptr_t m);
+bool clarabel_DefaultSolver_f32_copy_solution(
+    RustDefaultSolverHandle_f32 solver, float *x, uintptr_t n, float *z, float *s, uintptr_t m);
+bool clarabel_DefaultSolver_f64_solve_kkt(RustDefaultSolverHandle_f64 solver, double *rhs, uintptr_t dim, uintptr_t nrhs);
+bool clarabel_DefaultSolver_f32_solve_kkt(RustDefaultSolverHandle_f32 solver, float *rhs, uintptr_t dim, uintptr_t nrhs);
+bool clarabel_DefaultSolver_f64_backward(RustDefaultSolverHandle_f64 solver,
+                                         const double *dx,
+                                         const double *dz,
+                                         const double *ds,
+                                         double *dP,
+                                         uintptr_t nnzP,
+                                         double *dq,
+                                         uintptr_t n,
+                                         double *dA,
+                                         uintptr_t nnzA,
+                                         double *db,
+                                         uintptr_t m);
+bool clarabel_DefaultSolver_f32_backward(RustDefaultSolverHandle_f32 solver,
+                                         const float *dx,
+                                         const float *dz,
+                                         const float *ds,
+                                         float *dP,
+                                         uintptr_t nnzP,
+                                         float *dq,
+                                         uintptr_t n,
+                                         float *dA,
+                                         uintptr_t nnzA,
+                                         float *db,
+                                         uintptr_t m);
+
 DefaultInfo<double> clarabel_DefaultSolver_f64_info(RustDefaultSolverHandle_f64 solver);
 
 DefaultInfo<float> clarabel_DefaultSolver_f32_info(RustDefaultSolverHandle_f32 solver);
 
+DefaultTimings clarabel_DefaultSolver_f64_timings(RustDefaultSolverHandle_f64 solver);
+DefaultTimings clarabel_DefaultSolver_f32_timings(RustDefaultSolverHandle_f32 solver);
+void clarabel_DefaultSolver_f64_reset_timings(RustDefaultSolverHandle_f64 solver);
+void clarabel_DefaultSolver_f32_reset_timings(RustDefaultSolverHandle_f32 solver);
+
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_clone(RustDefaultSolverHandle_f64 solver);
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_clone(RustDefaultSolverHandle_f32 solver);
+
+void clarabel_DefaultSolver_f64_set_pattern_locked(RustDefaultSolverHandle_f64 solver, bool locked);
+void clarabel_DefaultSolver_f32_set_pattern_locked(RustDefaultSolverHandle_f32 solver, bool locked);
+bool clarabel_DefaultSolver_f64_pattern_locked(RustDefaultSolverHandle_f64 solver);
+bool clarabel_DefaultSolver_f32_pattern_locked(RustDefaultSolverHandle_f32 solver);
+
 void clarabel_DefaultSolver_f64_set_termination_callback(RustDefaultSolverHandle_f64 solver, int (*callback)(DefaultInfo<double>& ,void*),void* userdata);
 void clarabel_DefaultSolver_f32_set_termination_callback(RustDefaultSolverHandle_f32 solver, int (*callback)(DefaultInfo<float>&, void*),void* userdata);
 void clarabel_DefaultSolver_f64_unset_termination_callback(RustDefaultSolverHandle_f64 solver);
 void clarabel_DefaultSolver_f32_unset_termination_callback(RustDefaultSolverHandle_f32 solver);
+void clarabel_DefaultSolver_f64_set_iteration_observer(RustDefaultSolverHandle_f64 solver, IterationRing<double> *ring);
+void clarabel_DefaultSolver_f32_set_iteration_observer(RustDefaultSolverHandle_f32 solver, IterationRing<float> *ring);
+
+void clarabel_DefaultSolver_f64_set_cancel_token(RustDefaultSolverHandle_f64 solver, RustCancelTokenHandle token);
+void clarabel_DefaultSolver_f32_set_cancel_token(RustDefaultSolverHandle_f32 solver, RustCancelTokenHandle token);
 
 
-void clarabel_DefaultSolver_f64_update_P_csc(RustDefaultSolverHandle_f64 solver, const CscMatrix<double> *P);
-void clarabel_DefaultSolver_f32_update_P_csc(RustDefaultSolverHandle_f32 solver, const CscMatrix<float> *P);
+bool clarabel_DefaultSolver_f64_update_P_csc(RustDefaultSolverHandle_f64 solver, const CscMatrix<double> *P);
+bool clarabel_DefaultSolver_f32_update_P_csc(RustDefaultSolverHandle_f32 solver, const CscMatrix<float> *P);
+bool clarabel_DefaultSolver_f64_update_P_csc_i32(RustDefaultSolverHandle_f64 solver, const CscMatrix32<double> *P);
+bool clarabel_DefaultSolver_f32_update_P_csc_i32(RustDefaultSolverHandle_f32 solver, const CscMatrix32<float> *P);
 void clarabel_DefaultSolver_f64_update_P(RustDefaultSolverHandle_f64 solver, const double *Pnzval, uintptr_t nnzP);
 void clarabel_DefaultSolver_f32_update_P(RustDefaultSolverHandle_f32 solver, const float  *Pnzval, uintptr_t nnzP);
 void clarabel_DefaultSolver_f64_update_P_partial(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
 void clarabel_DefaultSolver_f32_update_P_partial(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
 
-void clarabel_DefaultSolver_f64_update_A_csc(RustDefaultSolverHandle_f64 solver, const CscMatrix<double> *A);
-void clarabel_DefaultSolver_f32_update_A_csc(RustDefaultSolverHandle_f32 solver, const CscMatrix<float> *A);
+bool clarabel_DefaultSolver_f64_update_A_csc(RustDefaultSolverHandle_f64 solver, const CscMatrix<double> *A);
+bool clarabel_DefaultSolver_f32_update_A_csc(RustDefaultSolverHandle_f32 solver, const CscMatrix<float> *A);
+bool clarabel_DefaultSolver_f64_update_A_csc_i32(RustDefaultSolverHandle_f64 solver, const CscMatrix32<double> *A);
+bool clarabel_DefaultSolver_f32_update_A_csc_i32(RustDefaultSolverHandle_f32 solver, const CscMatrix32<float> *A);
 void clarabel_DefaultSolver_f64_update_A(RustDefaultSolverHandle_f64 solver, const double *Anzval, uintptr_t nnzA);
 void clarabel_DefaultSolver_f32_update_A(RustDefaultSolverHandle_f32 solver, const float  *Anzval, uintptr_t nnzA);
 void clarabel_DefaultSolver_f64_update_A_partial(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
@@ -263,6 +821,26 @@ void clarabel_DefaultSolver_f32_update_b(RustDefaultSolverHandle_f32 solver, con
 void clarabel_DefaultSolver_f64_update_b_partial(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
 void clarabel_DefaultSolver_f32_update_b_partial(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
 
+bool clarabel_DefaultSolver_f64_update_P_sorted(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_P_sorted(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_P_sorted_i32(RustDefaultSolverHandle_f64 solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_P_sorted_i32(RustDefaultSolverHandle_f32 solver, const int32_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_A_sorted(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_A_sorted(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_A_sorted_i32(RustDefaultSolverHandle_f64 solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_A_sorted_i32(RustDefaultSolverHandle_f32 solver, const int32_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_q_sorted(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_q_sorted(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_q_sorted_i32(RustDefaultSolverHandle_f64 solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_q_sorted_i32(RustDefaultSolverHandle_f32 solver, const int32_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_b_sorted(RustDefaultSolverHandle_f64 solver, const uintptr_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_b_sorted(RustDefaultSolverHandle_f32 solver, const uintptr_t* index, const float *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f64_update_b_sorted_i32(RustDefaultSolverHandle_f64 solver, const int32_t* index, const double *values, uintptr_t nvals);
+bool clarabel_DefaultSolver_f32_update_b_sorted_i32(RustDefaultSolverHandle_f32 solver, const int32_t* index, const float *values, uintptr_t nvals);
+
+void clarabel_DefaultSolver_f64_update_data(RustDefaultSolverHandle_f64 solver, const double *Pnzval, uintptr_t nnzP, const double *q, uintptr_t n, const double *Anzval, uintptr_t nnzA, const double *b, uintptr_t m);
+void clarabel_DefaultSolver_f32_update_data(RustDefaultSolverHandle_f32 solver, const float *Pnzval, uintptr_t nnzP, const float *q, uintptr_t n, const float *Anzval, uintptr_t nnzA, const float *b, uintptr_t m);
+
 #ifdef FEATURE_SERDE
 void clarabel_DefaultSolver_f64_save_to_file(RustDefaultSolverHandle_f64 solver, const char *filename);
 void clarabel_DefaultSolver_f32_save_to_file(RustDefaultSolverHandle_f32 solver, const char *filename);
@@ -270,6 +848,11 @@ RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_load_from_file( const cha
 RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_load_from_file( const char *filename);
 #endif
 
+bool clarabel_DefaultSolver_f64_save_binary(RustDefaultSolverHandle_f64 solver, const char *filename);
+bool clarabel_DefaultSolver_f32_save_binary(RustDefaultSolverHandle_f32 solver, const char *filename);
+RustDefaultSolverHandle_f64 clarabel_DefaultSolver_f64_load_binary(const char *filename, const DefaultSettings<double> *settings);
+RustDefaultSolverHandle_f32 clarabel_DefaultSolver_f32_load_binary(const char *filename, const DefaultSettings<float> *settings);
+
 void clarabel_DefaultSolver_f64_print_to_stdout(RustDefaultSolverHandle_f64 solver);
 void clarabel_DefaultSolver_f32_print_to_stdout(RustDefaultSolverHandle_f32 solver);
 void clarabel_DefaultSolver_f64_print_to_file(RustDefaultSolverHandle_f64 solver, const char *filename);
@@ -279,53 +862,263 @@ void clarabel_DefaultSolver_f32_print_to_buffer(RustDefaultSolverHandle_f32 solv
 const char* clarabel_DefaultSolver_f64_get_print_buffer(RustDefaultSolverHandle_f64 solver);
 const char* clarabel_DefaultSolver_f32_get_print_buffer(RustDefaultSolverHandle_f32 solver);
 void clarabel_free_print_buffer(const char *s);
+void clarabel_DefaultSolver_f64_print_to_fixed_buffer(RustDefaultSolverHandle_f64 solver, char *buffer, uintptr_t capacity);
+void clarabel_DefaultSolver_f32_print_to_fixed_buffer(RustDefaultSolverHandle_f32 solver, char *buffer, uintptr_t capacity);
+uintptr_t clarabel_DefaultSolver_f64_fixed_buffer_len(RustDefaultSolverHandle_f64 solver);
+uintptr_t clarabel_DefaultSolver_f32_fixed_buffer_len(RustDefaultSolverHandle_f32 solver);
+void clarabel_DefaultSolver_f64_print_to_callback(RustDefaultSolverHandle_f64 solver, void (*callback)(const char *, uintptr_t, void *), void *userdata);
+void clarabel_DefaultSolver_f32_print_to_callback(RustDefaultSolverHandle_f32 solver, void (*callback)(const char *, uintptr_t, void *), void *userdata);
+
+uint64_t clarabel_structure_hash_f64(const CscMatrix<double> *P, const CscMatrix<double> *A, uintptr_t n_cones, const SupportedConeT<double> *cones);
+uint64_t clarabel_structure_hash_f32(const CscMatrix<float> *P, const CscMatrix<float> *A, uintptr_t n_cones, const SupportedConeT<float> *cones);
+uint64_t clarabel_structure_hash_f64_i32(const CscMatrix32<double> *P, const CscMatrix32<double> *A, uintptr_t n_cones, const SupportedConeT<double> *cones);
+uint64_t clarabel_structure_hash_f32_i32(const CscMatrix32<float> *P, const CscMatrix32<float> *A, uintptr_t n_cones, const SupportedConeT<float> *cones);
+bool clarabel_CscMatrix_f64_same_pattern(const CscMatrix<double> *A, const CscMatrix<double> *B);
+bool clarabel_CscMatrix_f32_same_pattern(const CscMatrix<float> *A, const CscMatrix<float> *B);
+bool clarabel_CscMatrix_f64_i32_same_pattern(const CscMatrix32<double> *A, const CscMatrix32<double> *B);
+bool clarabel_CscMatrix_f32_i32_same_pattern(const CscMatrix32<float> *A, const CscMatrix32<float> *B);
 
 } // extern "C"
 
 
 
-// Convert unique_ptr P, A to CscMatrix objects, then init the solver
+// Convert P, A to CscMatrix objects, then init the solver
 // The CscMatrix objects are only used to pass the information needed to Rust.
-// The colptr and rowptr are stored in the ConvertedCscMatrix objects, which are kept alive by the unique_ptr.
-// No conversion is needed for nzval, so the Eigen sparse matrices must be kept alive until the solver is destroyed.
-template<>
-inline DefaultSolver<double>::DefaultSolver(const Eigen::SparseMatrix<double, Eigen::ColMajor> &P,
-                                            const Eigen::Ref<Eigen::VectorX<double>> &q,
-                                            const Eigen::SparseMatrix<double, Eigen::ColMajor> &A,
-                                            const Eigen::Ref<Eigen::VectorX<double>> &b,
-                                            const std::vector<SupportedConeT<double>> &cones,
-                                            const DefaultSettings<double> &settings)
+// The colptr and rowval are either borrowed from the Eigen matrices or stored in the ConvertedCsc objects,
+// which are kept alive until the solver has been created.  No conversion is needed for nzval.
+template<typename T>
+inline DefaultSolver<T>::DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                       const Eigen::SparseMatrix<T, Eigen::ColMajor> &A,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                       const std::vector<SupportedConeT<T>> &cones,
+                                       const DefaultSettings<T> &settings)
+{
+    init(P, q, A, b, cones, settings);
+}
+
+template<typename T>
+template<typename StorageIndex>
+inline DefaultSolver<T>::DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                       const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                       const std::vector<SupportedConeT<T>> &cones,
+                                       const DefaultSettings<T> &settings)
+{
+    init(P, q, A, b, cones, settings);
+}
+
+template<typename T>
+inline DefaultSolver<T>::DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                       const Eigen::SparseMatrix<T, Eigen::ColMajor> &A,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                       const std::vector<SupportedConeT<T>> &cones,
+                                       const DefaultSettingsHandle<T> &settings)
+{
+    init(P, q, A, b, cones, settings);
+}
+
+template<typename T>
+template<typename StorageIndex>
+inline DefaultSolver<T>::DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                       const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                       const std::vector<SupportedConeT<T>> &cones,
+                                       const DefaultSettingsHandle<T> &settings)
+{
+    init(P, q, A, b, cones, settings);
+}
+
+template<typename T>
+template<typename StorageIndex>
+inline DefaultSolver<T>::DefaultSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                       const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                       const std::vector<SupportedConeT<T>> &cones,
+                                       const KeepProblemData &settings)
+{
+    init(P, q, A, b, cones, settings);
+}
+
+template<typename T>
+template<typename StorageIndex, typename Settings>
+inline void DefaultSolver<T>::init(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                   const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                   const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                   const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                   const std::vector<SupportedConeT<T>> &cones,
+                                   const Settings &settings)
 {
     // Rust wrapper will assume the pointers represent matrices with the right dimensions.
     // segfault will occur if the dimensions are incorrect
     check_dimensions(P, q, A, b, cones);
 
-    ConvertedCscMatrix matrix_P = DefaultSolver<double>::eigen_sparse_to_clarabel(P);
-    ConvertedCscMatrix matrix_A = DefaultSolver<double>::eigen_sparse_to_clarabel(A);
-    CscMatrix<double> p(matrix_P.m, matrix_P.n, matrix_P.colptr.data(), matrix_P.rowval.data(), matrix_P.nzval);
-    CscMatrix<double> a(matrix_A.m, matrix_A.n, matrix_A.colptr.data(), matrix_A.rowval.data(), matrix_A.nzval);
+    ConvertedFor<StorageIndex> matrix_P = eigen_sparse_to_clarabel(P);
+    ConvertedFor<StorageIndex> matrix_A = eigen_sparse_to_clarabel(A);
 
-    this->handle = clarabel_DefaultSolver_f64_new(&p, q.data(), &a, b.data(), cones.size(), cones.data(), &settings);
+    this->handle = create_handle(matrix_P, q.data(), matrix_A, b.data(), cones, settings);
+    pattern_P = PatternKey::of(P);
+    pattern_A = PatternKey::of(A);
 }
 
 template<>
-inline DefaultSolver<float>::DefaultSolver(const Eigen::SparseMatrix<float, Eigen::ColMajor> &P,
-                                           const Eigen::Ref<Eigen::VectorX<float>> &q,
-                                           const Eigen::SparseMatrix<float, Eigen::ColMajor> &A,
-                                           const Eigen::Ref<Eigen::VectorX<float>> &b,
-                                           const std::vector<SupportedConeT<float>> &cones,
-                                           const DefaultSettings<float> &settings)
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const DefaultSettings<double> &settings)
 {
-    // Rust wrapper will assume the pointers represent matrices with the right dimensions.
-    // segfault will occur if the dimensions are incorrect
-    check_dimensions(P, q, A, b, cones);
+    CscMatrix<double> p = P.as_csc();
+    CscMatrix<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new(&p, q, &a, b, cones.size(), cones.data(), &settings);
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const DefaultSettings<float> &settings)
+{
+    CscMatrix<float> p = P.as_csc();
+    CscMatrix<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new(&p, q, &a, b, cones.size(), cones.data(), &settings);
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix32 &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix32 &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const DefaultSettings<double> &settings)
+{
+    CscMatrix32<double> p = P.as_csc();
+    CscMatrix32<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new_i32(&p, q, &a, b, cones.size(), cones.data(), &settings);
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix32 &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix32 &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const DefaultSettings<float> &settings)
+{
+    CscMatrix32<float> p = P.as_csc();
+    CscMatrix32<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new_i32(&p, q, &a, b, cones.size(), cones.data(), &settings);
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const DefaultSettingsHandle<double> &settings)
+{
+    CscMatrix<double> p = P.as_csc();
+    CscMatrix<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new_with_settings_handle(&p, q, &a, b, cones.size(), cones.data(), settings.get());
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const DefaultSettingsHandle<float> &settings)
+{
+    CscMatrix<float> p = P.as_csc();
+    CscMatrix<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new_with_settings_handle(&p, q, &a, b, cones.size(), cones.data(), settings.get());
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix32 &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix32 &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const DefaultSettingsHandle<double> &settings)
+{
+    CscMatrix32<double> p = P.as_csc();
+    CscMatrix32<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new_i32_with_settings_handle(&p, q, &a, b, cones.size(), cones.data(), settings.get());
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix32 &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix32 &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const DefaultSettingsHandle<float> &settings)
+{
+    CscMatrix32<float> p = P.as_csc();
+    CscMatrix32<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new_i32_with_settings_handle(&p, q, &a, b, cones.size(), cones.data(), settings.get());
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const KeepProblemData &settings)
+{
+    CscMatrix<double> p = P.as_csc();
+    CscMatrix<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new_keep_data(&p, q, &a, b, cones.size(), cones.data(), &settings.settings);
+}
+
+template<>
+inline RustObjectHandle DefaultSolver<double>::create_handle(const ConvertedCscMatrix32 &P,
+                                                             const double *q,
+                                                             const ConvertedCscMatrix32 &A,
+                                                             const double *b,
+                                                             const std::vector<SupportedConeT<double>> &cones,
+                                                             const KeepProblemData &settings)
+{
+    CscMatrix32<double> p = P.as_csc();
+    CscMatrix32<double> a = A.as_csc();
+    return clarabel_DefaultSolver_f64_new_i32_keep_data(&p, q, &a, b, cones.size(), cones.data(), &settings.settings);
+}
 
-    ConvertedCscMatrix matrix_P = DefaultSolver<float>::eigen_sparse_to_clarabel(P);
-    ConvertedCscMatrix matrix_A = DefaultSolver<float>::eigen_sparse_to_clarabel(A);
-    CscMatrix<float> p(matrix_P.m, matrix_P.n, matrix_P.colptr.data(), matrix_P.rowval.data(), matrix_P.nzval);
-    CscMatrix<float> a(matrix_A.m, matrix_A.n, matrix_A.colptr.data(), matrix_A.rowval.data(), matrix_A.nzval);
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const KeepProblemData &settings)
+{
+    CscMatrix<float> p = P.as_csc();
+    CscMatrix<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new_keep_data(&p, q, &a, b, cones.size(), cones.data(), &settings.settings);
+}
 
-    this->handle = clarabel_DefaultSolver_f32_new(&p, q.data(), &a, b.data(), cones.size(), cones.data(), &settings);
+template<>
+inline RustObjectHandle DefaultSolver<float>::create_handle(const ConvertedCscMatrix32 &P,
+                                                            const float *q,
+                                                            const ConvertedCscMatrix32 &A,
+                                                            const float *b,
+                                                            const std::vector<SupportedConeT<float>> &cones,
+                                                            const KeepProblemData &settings)
+{
+    CscMatrix32<float> p = P.as_csc();
+    CscMatrix32<float> a = A.as_csc();
+    return clarabel_DefaultSolver_f32_new_i32_keep_data(&p, q, &a, b, cones.size(), cones.data(), &settings.settings);
 }
 
 template<>
@@ -364,6 +1157,40 @@ inline void DefaultSolver<float>::solve()
     clarabel_DefaultSolver_f32_solve(handle);
 }
 
+template<typename T>
+inline std::future<DefaultInfo<T>> DefaultSolver<T>::solve_async()
+{
+    // owned by the completion callback once the solve is queued
+    std::promise<DefaultInfo<T>> *promise = new std::promise<DefaultInfo<T>>();
+    std::future<DefaultInfo<T>> result = promise->get_future();
+    solve_async_handle(promise);
+    return result;
+}
+
+template<typename T>
+inline void DefaultSolver<T>::complete_async(RustObjectHandle, const DefaultInfo<T> *info, void *userdata)
+{
+    std::unique_ptr<std::promise<DefaultInfo<T>>> promise(static_cast<std::promise<DefaultInfo<T>> *>(userdata));
+    if (info == nullptr)
+    {
+        promise->set_exception(std::make_exception_ptr(std::runtime_error("Asynchronous solve failed.")));
+        return;
+    }
+    promise->set_value(*info);
+}
+
+template<>
+inline void DefaultSolver<double>::solve_async_handle(void *promise)
+{
+    clarabel_DefaultSolver_f64_solve_async(handle, &DefaultSolver<double>::complete_async, promise);
+}
+
+template<>
+inline void DefaultSolver<float>::solve_async_handle(void *promise)
+{
+    clarabel_DefaultSolver_f32_solve_async(handle, &DefaultSolver<float>::complete_async, promise);
+}
+
 template<>
 inline DefaultSolution<double> DefaultSolver<double>::solution() const
 {
@@ -378,121 +1205,419 @@ inline DefaultSolution<float> DefaultSolver<float>::solution() const
     return std::move(DefaultSolution<float>(solution));
 }
 
-template<>
-inline DefaultInfo<double> DefaultSolver<double>::info() const
+template<typename T>
+inline void DefaultSolver<T>::solution_into(Eigen::Ref<Eigen::VectorX<T>> x,
+                                            Eigen::Ref<Eigen::VectorX<T>> z,
+                                            Eigen::Ref<Eigen::VectorX<T>> s) const
 {
-    return clarabel_DefaultSolver_f64_info(handle);
+    if (z.size() != s.size() || !copy_solution(x.data(), x.size(), z.data(), s.data(), z.size()))
+    {
+        throw std::invalid_argument("x must have length n, and z and s length m");
+    }
 }
 
-template<>
-inline DefaultInfo<float> DefaultSolver<float>::info() const
+template<typename T>
+inline void DefaultSolver<T>::solution_into(Eigen::Ref<Eigen::VectorX<T>> x) const
 {
-    return clarabel_DefaultSolver_f32_info(handle);
+    if (!copy_solution(x.data(), x.size(), nullptr, nullptr, 0))
+    {
+        throw std::invalid_argument("x must have length n");
+    }
 }
 
-
 template<>
-inline void DefaultSolver<double>::set_termination_callback(int (*callback)(DefaultInfo<double>&, void*), void* userdata) {
-    clarabel_DefaultSolver_f64_set_termination_callback(this->handle, callback,userdata);
+inline bool DefaultSolver<double>::copy_solution(double *x, uintptr_t n, double *z, double *s, uintptr_t m) const
+{
+    return clarabel_DefaultSolver_f64_copy_solution(handle, x, n, z, s, m);
 }
 
 template<>
-inline void DefaultSolver<float>::set_termination_callback(int (*callback)(DefaultInfo<float>&, void*), void* userdata) {
-    clarabel_DefaultSolver_f32_set_termination_callback(this->handle, callback, userdata);
+inline bool DefaultSolver<float>::copy_solution(float *x, uintptr_t n, float *z, float *s, uintptr_t m) const
+{
+    return clarabel_DefaultSolver_f32_copy_solution(handle, x, n, z, s, m);
 }
 
 template<>
-inline void DefaultSolver<double>::unset_termination_callback() {
-    clarabel_DefaultSolver_f64_unset_termination_callback(this->handle);
+inline void DefaultSolver<double>::solve_kkt(const Eigen::MatrixX<double> &rhs, Eigen::MatrixX<double> &out)
+{
+    out = rhs;
+    if (!clarabel_DefaultSolver_f64_solve_kkt(handle, out.data(), out.rows(), out.cols()))
+    {
+        throw std::runtime_error("Failed to solve the KKT system");
+    }
 }
 
 template<>
-inline void DefaultSolver<float>::unset_termination_callback() {
-    clarabel_DefaultSolver_f32_unset_termination_callback(this->handle);
+inline void DefaultSolver<float>::solve_kkt(const Eigen::MatrixX<float> &rhs, Eigen::MatrixX<float> &out)
+{
+    out = rhs;
+    if (!clarabel_DefaultSolver_f32_solve_kkt(handle, out.data(), out.rows(), out.cols()))
+    {
+        throw std::runtime_error("Failed to solve the KKT system");
+    }
 }
 
-// update P
+template<typename T>
+inline void DefaultSolver<T>::backward(const Eigen::Ref<Eigen::VectorX<T>> &dx,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &dz,
+                                       const Eigen::Ref<Eigen::VectorX<T>> &ds,
+                                       Eigen::Ref<Eigen::VectorX<T>> dP,
+                                       Eigen::Ref<Eigen::VectorX<T>> dq,
+                                       Eigen::Ref<Eigen::VectorX<T>> dA,
+                                       Eigen::Ref<Eigen::VectorX<T>> db)
+{
+    if (dx.size() != dq.size())
+    {
+        throw std::invalid_argument("dx and dq must have the same length");
+    }
+    if (dz.size() != db.size() || ds.size() != db.size())
+    {
+        throw std::invalid_argument("dz, ds and db must have the same length");
+    }
+    if (!backward_impl(dx.data(), dz.data(), ds.data(), dP.data(), dP.size(), dq.data(), dq.size(), dA.data(),
+                       dA.size(), db.data(), db.size()))
+    {
+        throw std::runtime_error("Failed to differentiate the solution");
+    }
+}
 
 template<>
-inline void DefaultSolver<double>::update_P(const Eigen::SparseMatrix<double, Eigen::ColMajor> &P){
-    ConvertedCscMatrix matrix_P = DefaultSolver<double>::eigen_sparse_to_clarabel(P);
-    CscMatrix<double> mat(matrix_P.m, matrix_P.n, matrix_P.colptr.data(), matrix_P.rowval.data(), matrix_P.nzval);
-     clarabel_DefaultSolver_f64_update_P_csc(this->handle,&mat);
+inline bool DefaultSolver<double>::backward_impl(const double *dx,
+                                                 const double *dz,
+                                                 const double *ds,
+                                                 double *dP,
+                                                 uintptr_t nnzP,
+                                                 double *dq,
+                                                 uintptr_t n,
+                                                 double *dA,
+                                                 uintptr_t nnzA,
+                                                 double *db,
+                                                 uintptr_t m)
+{
+    return clarabel_DefaultSolver_f64_backward(handle, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m);
 }
 
 template<>
-inline void DefaultSolver<float>::update_P(const Eigen::SparseMatrix<float, Eigen::ColMajor> &P){
-    ConvertedCscMatrix matrix_P = DefaultSolver<float>::eigen_sparse_to_clarabel(P);
-    CscMatrix<float> mat(matrix_P.m, matrix_P.n, matrix_P.colptr.data(), matrix_P.rowval.data(), matrix_P.nzval);
-    clarabel_DefaultSolver_f32_update_P_csc(this->handle,&mat);
+inline bool DefaultSolver<float>::backward_impl(const float *dx,
+                                                const float *dz,
+                                                const float *ds,
+                                                float *dP,
+                                                uintptr_t nnzP,
+                                                float *dq,
+                                                uintptr_t n,
+                                                float *dA,
+                                                uintptr_t nnzA,
+                                                float *db,
+                                                uintptr_t m)
+{
+    return clarabel_DefaultSolver_f32_backward(handle, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m);
 }
 
 template<>
-inline void DefaultSolver<double>::update_P(const Eigen::Ref<Eigen::VectorX<double>> &nzval){
-     clarabel_DefaultSolver_f64_update_P(this->handle,nzval.data(), nzval.size());
+inline DefaultInfo<double> DefaultSolver<double>::info() const
+{
+    return clarabel_DefaultSolver_f64_info(handle);
 }
 
 template<>
-inline void DefaultSolver<float>::update_P(const Eigen::Ref<Eigen::VectorX<float>> &nzval){
-    clarabel_DefaultSolver_f32_update_P(this->handle,nzval.data(), nzval.size());
+inline DefaultInfo<float> DefaultSolver<float>::info() const
+{
+    return clarabel_DefaultSolver_f32_info(handle);
 }
 
 template<>
-inline void DefaultSolver<double>::update_P(const double *nzval, uintptr_t nnz){
-     clarabel_DefaultSolver_f64_update_P(this->handle, nzval, nnz);
+inline DefaultTimings DefaultSolver<double>::timings() const
+{
+    return clarabel_DefaultSolver_f64_timings(handle);
 }
 
 template<>
-inline void DefaultSolver<float>::update_P(const float *nzval, uintptr_t nnz){
-    clarabel_DefaultSolver_f32_update_P(this->handle, nzval, nnz);
+inline DefaultTimings DefaultSolver<float>::timings() const
+{
+    return clarabel_DefaultSolver_f32_timings(handle);
 }
 
 template<>
-inline void DefaultSolver<double>::update_P(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<double>> &values){
-    if(index.size() != values.size()){
-        throw std::invalid_argument("index and values must have the same size");
-    }
-     clarabel_DefaultSolver_f64_update_P_partial(this->handle, index.data(), values.data(), index.size());
+inline void DefaultSolver<double>::reset_timings()
+{
+    clarabel_DefaultSolver_f64_reset_timings(handle);
 }
 
 template<>
-inline void DefaultSolver<float>::update_P(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<float>> &values){
-    if(index.size() != values.size()){
-        throw std::invalid_argument("index and values must have the same size");
-    }
-     clarabel_DefaultSolver_f32_update_P_partial(this->handle, index.data(), values.data(), index.size());
+inline void DefaultSolver<float>::reset_timings()
+{
+    clarabel_DefaultSolver_f32_reset_timings(handle);
 }
 
 template<>
-inline void DefaultSolver<double>::update_P(const uintptr_t* index, const double *values, uintptr_t nvals){
-     clarabel_DefaultSolver_f64_update_P_partial(this->handle, index, values, nvals);
+inline DefaultSolver<double> DefaultSolver<double>::clone() const
+{
+    RustDefaultSolverHandle_f64 copy = clarabel_DefaultSolver_f64_clone(handle);
+    if (copy == nullptr)
+    {
+        throw std::runtime_error("Solver does not hold the problem data needed for cloning.");
+    }
+    return DefaultSolver<double>(copy);
 }
 
 template<>
-inline void DefaultSolver<float>::update_P(const uintptr_t* index, const float *values, uintptr_t nvals){
-     clarabel_DefaultSolver_f32_update_P_partial(this->handle, index, values, nvals);
+inline DefaultSolver<float> DefaultSolver<float>::clone() const
+{
+    RustDefaultSolverHandle_f32 copy = clarabel_DefaultSolver_f32_clone(handle);
+    if (copy == nullptr)
+    {
+        throw std::runtime_error("Solver does not hold the problem data needed for cloning.");
+    }
+    return DefaultSolver<float>(copy);
 }
 
-
-// update A
-
 template<>
-inline void DefaultSolver<double>::update_A(const Eigen::SparseMatrix<double, Eigen::ColMajor> &A){
-    ConvertedCscMatrix matrix_A = DefaultSolver<double>::eigen_sparse_to_clarabel(A);
-    CscMatrix<double> mat(matrix_A.m, matrix_A.n, matrix_A.colptr.data(), matrix_A.rowval.data(), matrix_A.nzval);
-     clarabel_DefaultSolver_f64_update_A_csc(this->handle,&mat);
+inline void DefaultSolver<double>::set_pattern_locked(bool locked)
+{
+    clarabel_DefaultSolver_f64_set_pattern_locked(handle, locked);
 }
 
 template<>
-inline void DefaultSolver<float>::update_A(const Eigen::SparseMatrix<float, Eigen::ColMajor> &A){
-    ConvertedCscMatrix matrix_A = DefaultSolver<float>::eigen_sparse_to_clarabel(A);
-    CscMatrix<float> mat(matrix_A.m, matrix_A.n, matrix_A.colptr.data(), matrix_A.rowval.data(), matrix_A.nzval);
-    clarabel_DefaultSolver_f32_update_A_csc(this->handle,&mat);
+inline void DefaultSolver<float>::set_pattern_locked(bool locked)
+{
+    clarabel_DefaultSolver_f32_set_pattern_locked(handle, locked);
 }
 
 template<>
-inline void DefaultSolver<double>::update_A(const Eigen::Ref<Eigen::VectorX<double>> &nzval){
-     clarabel_DefaultSolver_f64_update_A(this->handle,nzval.data(), nzval.size());
+inline bool DefaultSolver<double>::pattern_locked() const
+{
+    return clarabel_DefaultSolver_f64_pattern_locked(handle);
+}
+
+template<>
+inline bool DefaultSolver<float>::pattern_locked() const
+{
+    return clarabel_DefaultSolver_f32_pattern_locked(handle);
+}
+
+
+template<>
+inline void DefaultSolver<double>::set_termination_callback(int (*callback)(DefaultInfo<double>&, void*), void* userdata) {
+    clarabel_DefaultSolver_f64_set_termination_callback(this->handle, callback,userdata);
+}
+
+template<>
+inline void DefaultSolver<float>::set_termination_callback(int (*callback)(DefaultInfo<float>&, void*), void* userdata) {
+    clarabel_DefaultSolver_f32_set_termination_callback(this->handle, callback, userdata);
+}
+
+template<>
+inline void DefaultSolver<double>::unset_termination_callback() {
+    clarabel_DefaultSolver_f64_unset_termination_callback(this->handle);
+}
+
+template<>
+inline void DefaultSolver<float>::unset_termination_callback() {
+    clarabel_DefaultSolver_f32_unset_termination_callback(this->handle);
+}
+
+template<>
+inline void DefaultSolver<double>::set_iteration_observer(IterationRing<double> &ring) {
+    clarabel_DefaultSolver_f64_set_iteration_observer(this->handle, &ring);
+}
+
+template<>
+inline void DefaultSolver<float>::set_iteration_observer(IterationRing<float> &ring) {
+    clarabel_DefaultSolver_f32_set_iteration_observer(this->handle, &ring);
+}
+
+template<>
+inline void DefaultSolver<double>::unset_iteration_observer() {
+    clarabel_DefaultSolver_f64_set_iteration_observer(this->handle, nullptr);
+}
+
+template<>
+inline void DefaultSolver<float>::unset_iteration_observer() {
+    clarabel_DefaultSolver_f32_set_iteration_observer(this->handle, nullptr);
+}
+
+template<>
+inline void DefaultSolver<double>::set_cancel_token(const CancelToken &token) {
+    clarabel_DefaultSolver_f64_set_cancel_token(this->handle, token.handle);
+}
+
+template<>
+inline void DefaultSolver<float>::set_cancel_token(const CancelToken &token) {
+    clarabel_DefaultSolver_f32_set_cancel_token(this->handle, token.handle);
+}
+
+template<>
+inline void DefaultSolver<double>::unset_cancel_token() {
+    clarabel_DefaultSolver_f64_set_cancel_token(this->handle, nullptr);
+}
+
+template<>
+inline void DefaultSolver<float>::unset_cancel_token() {
+    clarabel_DefaultSolver_f32_set_cancel_token(this->handle, nullptr);
+}
+
+// update P
+
+template<>
+inline void DefaultSolver<double>::update_P_csc(const ConvertedCscMatrix &P){
+    CscMatrix<double> mat = P.as_csc();
+    if (!clarabel_DefaultSolver_f64_update_P_csc(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of P does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<double>::update_P_csc(const ConvertedCscMatrix32 &P){
+    CscMatrix32<double> mat = P.as_csc();
+    if (!clarabel_DefaultSolver_f64_update_P_csc_i32(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of P does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<float>::update_P_csc(const ConvertedCscMatrix &P){
+    CscMatrix<float> mat = P.as_csc();
+    if (!clarabel_DefaultSolver_f32_update_P_csc(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of P does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<float>::update_P_csc(const ConvertedCscMatrix32 &P){
+    CscMatrix32<float> mat = P.as_csc();
+    if (!clarabel_DefaultSolver_f32_update_P_csc_i32(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of P does not match the pattern of the solver.");
+    }
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_P(const Eigen::SparseMatrix<T, Eigen::ColMajor> &P){
+    this->template update_P<typename Eigen::SparseMatrix<T, Eigen::ColMajor>::StorageIndex>(P);
+}
+
+template<typename T>
+template<typename StorageIndex>
+inline void DefaultSolver<T>::update_P(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P){
+    PatternKey key = PatternKey::of(P);
+    if (key.matches(pattern_P) && !pattern_locked())
+    {
+        update_P(P.valuePtr(), static_cast<uintptr_t>(P.nonZeros()));
+        return;
+    }
+    update_P_csc(eigen_sparse_to_clarabel(P));
+    pattern_P = key;
+}
+
+template<>
+inline void DefaultSolver<double>::update_P(const Eigen::Ref<Eigen::VectorX<double>> &nzval){
+     clarabel_DefaultSolver_f64_update_P(this->handle,nzval.data(), nzval.size());
+}
+
+template<>
+inline void DefaultSolver<float>::update_P(const Eigen::Ref<Eigen::VectorX<float>> &nzval){
+    clarabel_DefaultSolver_f32_update_P(this->handle,nzval.data(), nzval.size());
+}
+
+template<>
+inline void DefaultSolver<double>::update_P(const double *nzval, uintptr_t nnz){
+     clarabel_DefaultSolver_f64_update_P(this->handle, nzval, nnz);
+}
+
+template<>
+inline void DefaultSolver<float>::update_P(const float *nzval, uintptr_t nnz){
+    clarabel_DefaultSolver_f32_update_P(this->handle, nzval, nnz);
+}
+
+template<>
+inline void DefaultSolver<double>::update_P(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<double>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+     clarabel_DefaultSolver_f64_update_P_partial(this->handle, index.data(), values.data(), index.size());
+}
+
+template<>
+inline void DefaultSolver<float>::update_P(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<float>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+     clarabel_DefaultSolver_f32_update_P_partial(this->handle, index.data(), values.data(), index.size());
+}
+
+template<>
+inline void DefaultSolver<double>::update_P(const uintptr_t* index, const double *values, uintptr_t nvals){
+     clarabel_DefaultSolver_f64_update_P_partial(this->handle, index, values, nvals);
+}
+
+template<>
+inline void DefaultSolver<float>::update_P(const uintptr_t* index, const float *values, uintptr_t nvals){
+     clarabel_DefaultSolver_f32_update_P_partial(this->handle, index, values, nvals);
+}
+
+
+// update A
+
+template<>
+inline void DefaultSolver<double>::update_A_csc(const ConvertedCscMatrix &A){
+    CscMatrix<double> mat = A.as_csc();
+    if (!clarabel_DefaultSolver_f64_update_A_csc(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of A does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<double>::update_A_csc(const ConvertedCscMatrix32 &A){
+    CscMatrix32<double> mat = A.as_csc();
+    if (!clarabel_DefaultSolver_f64_update_A_csc_i32(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of A does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<float>::update_A_csc(const ConvertedCscMatrix &A){
+    CscMatrix<float> mat = A.as_csc();
+    if (!clarabel_DefaultSolver_f32_update_A_csc(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of A does not match the pattern of the solver.");
+    }
+}
+
+template<>
+inline void DefaultSolver<float>::update_A_csc(const ConvertedCscMatrix32 &A){
+    CscMatrix32<float> mat = A.as_csc();
+    if (!clarabel_DefaultSolver_f32_update_A_csc_i32(this->handle,&mat))
+    {
+        throw std::invalid_argument("The sparsity pattern of A does not match the pattern of the solver.");
+    }
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_A(const Eigen::SparseMatrix<T, Eigen::ColMajor> &A){
+    this->template update_A<typename Eigen::SparseMatrix<T, Eigen::ColMajor>::StorageIndex>(A);
+}
+
+template<typename T>
+template<typename StorageIndex>
+inline void DefaultSolver<T>::update_A(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A){
+    PatternKey key = PatternKey::of(A);
+    if (key.matches(pattern_A) && !pattern_locked())
+    {
+        update_A(A.valuePtr(), static_cast<uintptr_t>(A.nonZeros()));
+        return;
+    }
+    update_A_csc(eigen_sparse_to_clarabel(A));
+    pattern_A = key;
+}
+
+template<>
+inline void DefaultSolver<double>::update_A(const Eigen::Ref<Eigen::VectorX<double>> &nzval){
+     clarabel_DefaultSolver_f64_update_A(this->handle,nzval.data(), nzval.size());
 }
 
 template<>
@@ -633,6 +1758,210 @@ inline void DefaultSolver<float>::update_b(const uintptr_t* index, const float *
      clarabel_DefaultSolver_f32_update_b_partial(this->handle, index, values, nvals);
 }
 
+// sorted partial updates
+
+template<>
+inline bool DefaultSolver<double>::update_sorted(DataField field, const uintptr_t *index, const double *values, uintptr_t nvals){
+    switch (field)
+    {
+        case DataField::P:
+            return clarabel_DefaultSolver_f64_update_P_sorted(this->handle, index, values, nvals);
+        case DataField::A:
+            return clarabel_DefaultSolver_f64_update_A_sorted(this->handle, index, values, nvals);
+        case DataField::q:
+            return clarabel_DefaultSolver_f64_update_q_sorted(this->handle, index, values, nvals);
+        case DataField::b:
+            return clarabel_DefaultSolver_f64_update_b_sorted(this->handle, index, values, nvals);
+    }
+    return false;
+}
+
+template<>
+inline bool DefaultSolver<double>::update_sorted(DataField field, const int32_t *index, const double *values, uintptr_t nvals){
+    switch (field)
+    {
+        case DataField::P:
+            return clarabel_DefaultSolver_f64_update_P_sorted_i32(this->handle, index, values, nvals);
+        case DataField::A:
+            return clarabel_DefaultSolver_f64_update_A_sorted_i32(this->handle, index, values, nvals);
+        case DataField::q:
+            return clarabel_DefaultSolver_f64_update_q_sorted_i32(this->handle, index, values, nvals);
+        case DataField::b:
+            return clarabel_DefaultSolver_f64_update_b_sorted_i32(this->handle, index, values, nvals);
+    }
+    return false;
+}
+
+template<>
+inline bool DefaultSolver<float>::update_sorted(DataField field, const uintptr_t *index, const float *values, uintptr_t nvals){
+    switch (field)
+    {
+        case DataField::P:
+            return clarabel_DefaultSolver_f32_update_P_sorted(this->handle, index, values, nvals);
+        case DataField::A:
+            return clarabel_DefaultSolver_f32_update_A_sorted(this->handle, index, values, nvals);
+        case DataField::q:
+            return clarabel_DefaultSolver_f32_update_q_sorted(this->handle, index, values, nvals);
+        case DataField::b:
+            return clarabel_DefaultSolver_f32_update_b_sorted(this->handle, index, values, nvals);
+    }
+    return false;
+}
+
+template<>
+inline bool DefaultSolver<float>::update_sorted(DataField field, const int32_t *index, const float *values, uintptr_t nvals){
+    switch (field)
+    {
+        case DataField::P:
+            return clarabel_DefaultSolver_f32_update_P_sorted_i32(this->handle, index, values, nvals);
+        case DataField::A:
+            return clarabel_DefaultSolver_f32_update_A_sorted_i32(this->handle, index, values, nvals);
+        case DataField::q:
+            return clarabel_DefaultSolver_f32_update_q_sorted_i32(this->handle, index, values, nvals);
+        case DataField::b:
+            return clarabel_DefaultSolver_f32_update_b_sorted_i32(this->handle, index, values, nvals);
+    }
+    return false;
+}
+
+template<typename T>
+template<typename Index>
+inline void DefaultSolver<T>::update_sorted_checked(DataField field, const Index *index, const T *values, uintptr_t nvals){
+    if (!update_sorted(field, index, values, nvals))
+    {
+        throw std::invalid_argument("indices must be strictly increasing and in range");
+    }
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_P_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::P, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_P_sorted(const uintptr_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::P, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_P_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::P, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_P_sorted(const int32_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::P, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_A_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::A, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_A_sorted(const uintptr_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::A, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_A_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::A, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_A_sorted(const int32_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::A, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_q_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::q, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_q_sorted(const uintptr_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::q, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_q_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::q, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_q_sorted(const int32_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::q, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_b_sorted(const Eigen::Ref<Eigen::VectorX<uintptr_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::b, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_b_sorted(const uintptr_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::b, index, values, nvals);
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_b_sorted(const Eigen::Ref<Eigen::VectorX<int32_t>> &index, const Eigen::Ref<Eigen::VectorX<T>> &values){
+    if(index.size() != values.size()){
+        throw std::invalid_argument("index and values must have the same size");
+    }
+    update_sorted_checked(DataField::b, index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void DefaultSolver<T>::update_b_sorted(const int32_t* index, const T* values, uintptr_t nvals){
+    update_sorted_checked(DataField::b, index, values, nvals);
+}
+
+// update P, q, A and b
+
+template<typename T>
+inline void DefaultSolver<T>::update_data(const Eigen::Ref<Eigen::VectorX<T>> &Pnzval,
+                                          const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                          const Eigen::Ref<Eigen::VectorX<T>> &Anzval,
+                                          const Eigen::Ref<Eigen::VectorX<T>> &b){
+    update_data(Pnzval.size() == 0 ? nullptr : Pnzval.data(), Pnzval.size(),
+                q.size() == 0 ? nullptr : q.data(), q.size(),
+                Anzval.size() == 0 ? nullptr : Anzval.data(), Anzval.size(),
+                b.size() == 0 ? nullptr : b.data(), b.size());
+}
+
+template<>
+inline void DefaultSolver<double>::update_data(const double *Pnzval, uintptr_t nnzP, const double *q, uintptr_t n,
+                                               const double *Anzval, uintptr_t nnzA, const double *b, uintptr_t m){
+    clarabel_DefaultSolver_f64_update_data(this->handle, Pnzval, nnzP, q, n, Anzval, nnzA, b, m);
+}
+
+template<>
+inline void DefaultSolver<float>::update_data(const float *Pnzval, uintptr_t nnzP, const float *q, uintptr_t n,
+                                              const float *Anzval, uintptr_t nnzA, const float *b, uintptr_t m){
+    clarabel_DefaultSolver_f32_update_data(this->handle, Pnzval, nnzP, q, n, Anzval, nnzA, b, m);
+}
+
 #ifdef FEATURE_SERDE
 template<>
 inline void DefaultSolver<double>::save_to_file(const std::string &filename){
@@ -657,6 +1986,68 @@ inline DefaultSolver<float> DefaultSolver<float>::load_from_file(const std::stri
 }
 #endif // FEATURE_SERDE
 
+template<>
+inline void DefaultSolver<double>::save_binary(const std::string &filename) const
+{
+    if (!clarabel_DefaultSolver_f64_save_binary(this->handle, filename.c_str()))
+    {
+        throw std::runtime_error("Failed to write snapshot " + filename);
+    }
+}
+
+template<>
+inline void DefaultSolver<float>::save_binary(const std::string &filename) const
+{
+    if (!clarabel_DefaultSolver_f32_save_binary(this->handle, filename.c_str()))
+    {
+        throw std::runtime_error("Failed to write snapshot " + filename);
+    }
+}
+
+template<>
+inline DefaultSolver<double> DefaultSolver<double>::load_binary(const std::string &filename)
+{
+    RustDefaultSolverHandle_f64 handle = clarabel_DefaultSolver_f64_load_binary(filename.c_str(), nullptr);
+    if (handle == nullptr)
+    {
+        throw std::runtime_error("Failed to load snapshot " + filename);
+    }
+    return DefaultSolver<double>(handle);
+}
+
+template<>
+inline DefaultSolver<double> DefaultSolver<double>::load_binary(const std::string &filename, const DefaultSettings<double> &settings)
+{
+    RustDefaultSolverHandle_f64 handle = clarabel_DefaultSolver_f64_load_binary(filename.c_str(), &settings);
+    if (handle == nullptr)
+    {
+        throw std::runtime_error("Failed to load snapshot " + filename);
+    }
+    return DefaultSolver<double>(handle);
+}
+
+template<>
+inline DefaultSolver<float> DefaultSolver<float>::load_binary(const std::string &filename)
+{
+    RustDefaultSolverHandle_f32 handle = clarabel_DefaultSolver_f32_load_binary(filename.c_str(), nullptr);
+    if (handle == nullptr)
+    {
+        throw std::runtime_error("Failed to load snapshot " + filename);
+    }
+    return DefaultSolver<float>(handle);
+}
+
+template<>
+inline DefaultSolver<float> DefaultSolver<float>::load_binary(const std::string &filename, const DefaultSettings<float> &settings)
+{
+    RustDefaultSolverHandle_f32 handle = clarabel_DefaultSolver_f32_load_binary(filename.c_str(), &settings);
+    if (handle == nullptr)
+    {
+        throw std::runtime_error("Failed to load snapshot " + filename);
+    }
+    return DefaultSolver<float>(handle);
+}
+
 // print configurations
 
 template<>
@@ -697,5 +2088,122 @@ inline std::string DefaultSolver<float>::get_print_buffer(){
     clarabel_free_print_buffer(buffer);
     return str;
 }
+template<>
+inline void DefaultSolver<double>::print_to_fixed_buffer(char *buffer, uintptr_t capacity){
+    clarabel_DefaultSolver_f64_print_to_fixed_buffer(this->handle, buffer, capacity);
+}
+template<>
+inline void DefaultSolver<float>::print_to_fixed_buffer(char *buffer, uintptr_t capacity){
+    clarabel_DefaultSolver_f32_print_to_fixed_buffer(this->handle, buffer, capacity);
+}
+template<>
+inline uintptr_t DefaultSolver<double>::fixed_buffer_len(){
+    return clarabel_DefaultSolver_f64_fixed_buffer_len(this->handle);
+}
+template<>
+inline uintptr_t DefaultSolver<float>::fixed_buffer_len(){
+    return clarabel_DefaultSolver_f32_fixed_buffer_len(this->handle);
+}
+template<>
+inline void DefaultSolver<double>::print_to_callback(void (*callback)(const char *, uintptr_t, void *), void *userdata){
+    clarabel_DefaultSolver_f64_print_to_callback(this->handle, callback, userdata);
+}
+template<>
+inline void DefaultSolver<float>::print_to_callback(void (*callback)(const char *, uintptr_t, void *), void *userdata){
+    clarabel_DefaultSolver_f32_print_to_callback(this->handle, callback, userdata);
+}
+
+// structure fingerprints
+
+template<>
+inline uint64_t DefaultSolver<double>::hash_structure(const ConvertedCscMatrix &P,
+                                                      const ConvertedCscMatrix &A,
+                                                      const std::vector<SupportedConeT<double>> &cones)
+{
+    CscMatrix<double> p = P.as_csc();
+    CscMatrix<double> a = A.as_csc();
+    return clarabel_structure_hash_f64(&p, &a, cones.size(), cones.data());
+}
+
+template<>
+inline uint64_t DefaultSolver<float>::hash_structure(const ConvertedCscMatrix &P,
+                                                     const ConvertedCscMatrix &A,
+                                                     const std::vector<SupportedConeT<float>> &cones)
+{
+    CscMatrix<float> p = P.as_csc();
+    CscMatrix<float> a = A.as_csc();
+    return clarabel_structure_hash_f32(&p, &a, cones.size(), cones.data());
+}
+
+template<>
+inline uint64_t DefaultSolver<double>::hash_structure(const ConvertedCscMatrix32 &P,
+                                                      const ConvertedCscMatrix32 &A,
+                                                      const std::vector<SupportedConeT<double>> &cones)
+{
+    CscMatrix32<double> p = P.as_csc();
+    CscMatrix32<double> a = A.as_csc();
+    return clarabel_structure_hash_f64_i32(&p, &a, cones.size(), cones.data());
+}
+
+template<>
+inline uint64_t DefaultSolver<float>::hash_structure(const ConvertedCscMatrix32 &P,
+                                                     const ConvertedCscMatrix32 &A,
+                                                     const std::vector<SupportedConeT<float>> &cones)
+{
+    CscMatrix32<float> p = P.as_csc();
+    CscMatrix32<float> a = A.as_csc();
+    return clarabel_structure_hash_f32_i32(&p, &a, cones.size(), cones.data());
+}
+
+template<>
+inline bool DefaultSolver<double>::compare_patterns(const ConvertedCscMatrix &A, const ConvertedCscMatrix &B)
+{
+    CscMatrix<double> a = A.as_csc();
+    CscMatrix<double> b = B.as_csc();
+    return clarabel_CscMatrix_f64_same_pattern(&a, &b);
+}
+
+template<>
+inline bool DefaultSolver<float>::compare_patterns(const ConvertedCscMatrix &A, const ConvertedCscMatrix &B)
+{
+    CscMatrix<float> a = A.as_csc();
+    CscMatrix<float> b = B.as_csc();
+    return clarabel_CscMatrix_f32_same_pattern(&a, &b);
+}
+
+template<>
+inline bool DefaultSolver<double>::compare_patterns(const ConvertedCscMatrix32 &A, const ConvertedCscMatrix32 &B)
+{
+    CscMatrix32<double> a = A.as_csc();
+    CscMatrix32<double> b = B.as_csc();
+    return clarabel_CscMatrix_f64_i32_same_pattern(&a, &b);
+}
+
+template<>
+inline bool DefaultSolver<float>::compare_patterns(const ConvertedCscMatrix32 &A, const ConvertedCscMatrix32 &B)
+{
+    CscMatrix32<float> a = A.as_csc();
+    CscMatrix32<float> b = B.as_csc();
+    return clarabel_CscMatrix_f32_i32_same_pattern(&a, &b);
+}
+
+// Stable fingerprint of the structure of a problem, for caching and deduplicating problems.  Problems with equal
+// hashes can almost always be handled by updating a solver in place rather than rebuilding it.
+template<typename T, typename StorageIndex>
+inline uint64_t structure_hash(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                               const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                               const std::vector<SupportedConeT<T>> &cones)
+{
+    return DefaultSolver<T>::structure_hash(P, A, cones);
+}
+
+// True if two matrices have the same dimensions and sparsity pattern.  DefaultSolver::update_P and update_A with a
+// sparse matrix already take the values-only path when the pattern is unchanged.
+template<typename T, typename StorageIndex>
+inline bool same_pattern(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                         const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &B)
+{
+    return DefaultSolver<T>::same_pattern(A, B);
+}
 
 } // namespace clarabel
\ No newline at end of file
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "CscMatrix.hpp"
+#include "DefaultSolver.hpp"
+
+#include <Eigen/Eigen>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace clarabel
+{
+
+using RustLdlSolverHandle_f64 = RustObjectHandle;
+using RustLdlSolverHandle_f32 = RustObjectHandle;
+
+extern "C" {
+RustLdlSolverHandle_f64 clarabel_LdlSolver_f64_new(const CscMatrix<double> *K, const int8_t *Dsigns);
+RustLdlSolverHandle_f32 clarabel_LdlSolver_f32_new(const CscMatrix<float> *K, const int8_t *Dsigns);
+RustLdlSolverHandle_f64 clarabel_LdlSolver_f64_new_i32(const CscMatrix32<double> *K, const int8_t *Dsigns);
+RustLdlSolverHandle_f32 clarabel_LdlSolver_f32_new_i32(const CscMatrix32<float> *K, const int8_t *Dsigns);
+void clarabel_LdlSolver_f64_free(RustLdlSolverHandle_f64 solver);
+void clarabel_LdlSolver_f32_free(RustLdlSolverHandle_f32 solver);
+
+void clarabel_LdlSolver_f64_update_values(RustLdlSolverHandle_f64 solver,
+                                          const uintptr_t *index,
+                                          const double *values,
+                                          uintptr_t nvals);
+void clarabel_LdlSolver_f32_update_values(RustLdlSolverHandle_f32 solver,
+                                          const uintptr_t *index,
+                                          const float *values,
+                                          uintptr_t nvals);
+bool clarabel_LdlSolver_f64_refactor(RustLdlSolverHandle_f64 solver, const double *nzval, uintptr_t nnz);
+bool clarabel_LdlSolver_f32_refactor(RustLdlSolverHandle_f32 solver, const float *nzval, uintptr_t nnz);
+void clarabel_LdlSolver_f64_solve(RustLdlSolverHandle_f64 solver, double *b, uintptr_t nrhs);
+void clarabel_LdlSolver_f32_solve(RustLdlSolverHandle_f32 solver, float *b, uintptr_t nrhs);
+uintptr_t clarabel_LdlSolver_f64_positive_inertia(RustLdlSolverHandle_f64 solver);
+uintptr_t clarabel_LdlSolver_f32_positive_inertia(RustLdlSolverHandle_f32 solver);
+} // extern "C"
+
+// Sparse LDL factorisation of a quasidefinite matrix K, using the QDLDL solver that DefaultSolver uses for its KKT
+// systems.  K is given by its upper triangle.  The symbolic analysis is done once on construction; values may then be
+// changed and K refactored with the same pattern.
+template<typename T = double>
+class LdlSolver
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
+
+  private:
+    using ConvertedCscMatrix = typename DefaultSolver<T>::ConvertedCscMatrix;
+    using ConvertedCscMatrix32 = typename DefaultSolver<T>::ConvertedCscMatrix32;
+
+    RustObjectHandle handle = nullptr;
+    Eigen::Index n = 0;
+    Eigen::Index nnz = 0;
+
+    static RustObjectHandle create_handle(const ConvertedCscMatrix &K, const int8_t *Dsigns);
+    static RustObjectHandle create_handle(const ConvertedCscMatrix32 &K, const int8_t *Dsigns);
+    void free_handle();
+    void update_values_impl(const uintptr_t *index, const T *values, uintptr_t nvals);
+    bool refactor_impl(const T *nzval, uintptr_t count);
+    void solve_columns(T *b, uintptr_t nrhs);
+
+  public:
+    // Dsigns holds the expected sign (+1 or -1) of each pivot, and may be left empty to factor without
+    // regularization.  When given, pivots of the wrong sign or too close to zero are regularized.  Throws
+    // std::invalid_argument for inconsistent dimensions or signs other than +1 and -1, and std::runtime_error if K
+    // cannot be factored.
+    template<typename StorageIndex>
+    explicit LdlSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &K,
+                       const std::vector<int8_t> &Dsigns = std::vector<int8_t>());
+    ~LdlSolver() { free_handle(); }
+
+    LdlSolver(const LdlSolver &) = delete;
+    LdlSolver &operator=(const LdlSolver &) = delete;
+    LdlSolver(LdlSolver &&other) : handle(other.handle), n(other.n), nnz(other.nnz) { other.handle = nullptr; }
+    LdlSolver &operator=(LdlSolver &&other)
+    {
+        if (this != &other)
+        {
+            free_handle();
+            handle = other.handle;
+            n = other.n;
+            nnz = other.nnz;
+            other.handle = nullptr;
+        }
+        return *this;
+    }
+
+    Eigen::Index dim() const { return n; }
+
+    // Change the entries of K at the given positions of its nonzero values.  Takes effect at the next refactor().
+    void update_values(const std::vector<uintptr_t> &index, const Eigen::Ref<Eigen::VectorX<T>> &values);
+
+    // Refactor K with its current values, or with all nonzero values replaced.  Throws std::runtime_error if K
+    // cannot be factored.
+    void refactor();
+    void refactor(const Eigen::Ref<Eigen::VectorX<T>> &nzval);
+
+    // Solve K x = b in place for every column of b
+    void solve(Eigen::Ref<Eigen::MatrixX<T>> b);
+
+    // number of positive pivots of the last factorisation
+    uintptr_t positive_inertia() const;
+};
+
+template<typename T>
+template<typename StorageIndex>
+inline LdlSolver<T>::LdlSolver(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &K,
+                               const std::vector<int8_t> &Dsigns)
+    : n(K.cols()), nnz(K.nonZeros())
+{
+    if (K.rows() != K.cols())
+    {
+        throw std::invalid_argument("K must be a square matrix");
+    }
+    if (!Dsigns.empty() && static_cast<Eigen::Index>(Dsigns.size()) != n)
+    {
+        throw std::invalid_argument("Dsigns must have one entry per column of K");
+    }
+    for (int8_t sign : Dsigns)
+    {
+        if (sign != 1 && sign != -1)
+        {
+            throw std::invalid_argument("Dsigns entries must be +1 or -1");
+        }
+    }
+
+    typename DefaultSolver<T>::template ConvertedFor<StorageIndex> matrix_K = DefaultSolver<T>::eigen_sparse_to_clarabel(K);
+
+    handle = create_handle(matrix_K, Dsigns.empty() ? nullptr : Dsigns.data());
+    if (handle == nullptr)
+    {
+        throw std::runtime_error("Failed to factor K");
+    }
+}
+
+template<typename T>
+inline void LdlSolver<T>::update_values(const std::vector<uintptr_t> &index, const Eigen::Ref<Eigen::VectorX<T>> &values)
+{
+    if (static_cast<Eigen::Index>(index.size()) != values.size())
+    {
+        throw std::invalid_argument("index and values must have the same length");
+    }
+    for (uintptr_t i : index)
+    {
+        if (i >= static_cast<uintptr_t>(nnz))
+        {
+            throw std::invalid_argument("index out of range");
+        }
+    }
+    update_values_impl(index.data(), values.data(), index.size());
+}
+
+template<typename T>
+inline void LdlSolver<T>::refactor(const Eigen::Ref<Eigen::VectorX<T>> &nzval)
+{
+    if (nzval.size() != nnz)
+    {
+        throw std::invalid_argument("nzval must have one entry per nonzero of K");
+    }
+    if (!refactor_impl(nzval.data(), static_cast<uintptr_t>(nzval.size())))
+    {
+        throw std::runtime_error("Failed to factor K");
+    }
+}
+
+template<typename T>
+inline void LdlSolver<T>::refactor()
+{
+    if (!refactor_impl(nullptr, 0))
+    {
+        throw std::runtime_error("Failed to factor K");
+    }
+}
+
+template<typename T>
+inline void LdlSolver<T>::solve(Eigen::Ref<Eigen::MatrixX<T>> b)
+{
+    if (b.rows() != n)
+    {
+        throw std::invalid_argument("b must have one row per column of K");
+    }
+    if (b.outerStride() == b.rows())
+    {
+        solve_columns(b.data(), static_cast<uintptr_t>(b.cols()));
+        return;
+    }
+    for (Eigen::Index j = 0; j < b.cols(); ++j)
+    {
+        solve_columns(b.col(j).data(), 1);
+    }
+}
+
+template<>
+inline RustObjectHandle LdlSolver<double>::create_handle(const ConvertedCscMatrix &K, const int8_t *Dsigns)
+{
+    CscMatrix<double> k = K.as_csc();
+    return clarabel_LdlSolver_f64_new(&k, Dsigns);
+}
+
+template<>
+inline RustObjectHandle LdlSolver<float>::create_handle(const ConvertedCscMatrix &K, const int8_t *Dsigns)
+{
+    CscMatrix<float> k = K.as_csc();
+    return clarabel_LdlSolver_f32_new(&k, Dsigns);
+}
+
+template<>
+inline RustObjectHandle LdlSolver<double>::create_handle(const ConvertedCscMatrix32 &K, const int8_t *Dsigns)
+{
+    CscMatrix32<double> k = K.as_csc();
+    return clarabel_LdlSolver_f64_new_i32(&k, Dsigns);
+}
+
+template<>
+inline RustObjectHandle LdlSolver<float>::create_handle(const ConvertedCscMatrix32 &K, const int8_t *Dsigns)
+{
+    CscMatrix32<float> k = K.as_csc();
+    return clarabel_LdlSolver_f32_new_i32(&k, Dsigns);
+}
+
+template<>
+inline void LdlSolver<double>::free_handle()
+{
+    if (handle != nullptr)
+    {
+        clarabel_LdlSolver_f64_free(handle);
+    }
+}
+
+template<>
+inline void LdlSolver<float>::free_handle()
+{
+    if (handle != nullptr)
+    {
+        clarabel_LdlSolver_f32_free(handle);
+    }
+}
+
+template<>
+inline void LdlSolver<double>::update_values_impl(const uintptr_t *index, const double *values, uintptr_t nvals)
+{
+    clarabel_LdlSolver_f64_update_values(handle, index, values, nvals);
+}
+
+template<>
+inline void LdlSolver<float>::update_values_impl(const uintptr_t *index, const float *values, uintptr_t nvals)
+{
+    clarabel_LdlSolver_f32_update_values(handle, index, values, nvals);
+}
+
+template<>
+inline bool LdlSolver<double>::refactor_impl(const double *nzval, uintptr_t count)
+{
+    return clarabel_LdlSolver_f64_refactor(handle, nzval, count);
+}
+
+template<>
+inline bool LdlSolver<float>::refactor_impl(const float *nzval, uintptr_t count)
+{
+    return clarabel_LdlSolver_f32_refactor(handle, nzval, count);
+}
+
+template<>
+inline void LdlSolver<double>::solve_columns(double *b, uintptr_t nrhs)
+{
+    clarabel_LdlSolver_f64_solve(handle, b, nrhs);
+}
+
+template<>
+inline void LdlSolver<float>::solve_columns(float *b, uintptr_t nrhs)
+{
+    clarabel_LdlSolver_f32_solve(handle, b, nrhs);
+}
+
+template<>
+inline uintptr_t LdlSolver<double>::positive_inertia() const
+{
+    return clarabel_LdlSolver_f64_positive_inertia(handle);
+}
+
+template<>
+inline uintptr_t LdlSolver<float>::positive_inertia() const
+{
+    return clarabel_LdlSolver_f32_positive_inertia(handle);
+}
+
+} // namespace clarabel
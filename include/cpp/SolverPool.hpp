@@ -0,0 +1,261 @@
+#pragma once
+
+#include "DefaultSettings.hpp"
+#include "DefaultSolver.hpp"
+#include "SupportedConeT.hpp"
+
+#include <Eigen/Eigen>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace clarabel
+{
+
+using RustSolverPoolHandle_f64 = RustObjectHandle;
+using RustSolverPoolHandle_f32 = RustObjectHandle;
+
+extern "C" {
+RustSolverPoolHandle_f64 clarabel_SolverPool_f64_new(const DefaultSettings<double> *settings, uintptr_t max_idle);
+RustSolverPoolHandle_f32 clarabel_SolverPool_f32_new(const DefaultSettings<float> *settings, uintptr_t max_idle);
+void clarabel_SolverPool_f64_free(RustSolverPoolHandle_f64 pool);
+void clarabel_SolverPool_f32_free(RustSolverPoolHandle_f32 pool);
+
+RustDefaultSolverHandle_f64 clarabel_SolverPool_f64_acquire(RustSolverPoolHandle_f64 pool,
+                                                            const CscMatrix<double> *P,
+                                                            const double *q,
+                                                            const CscMatrix<double> *A,
+                                                            const double *b,
+                                                            uintptr_t n_cones,
+                                                            const SupportedConeT<double> *cones);
+RustDefaultSolverHandle_f32 clarabel_SolverPool_f32_acquire(RustSolverPoolHandle_f32 pool,
+                                                            const CscMatrix<float> *P,
+                                                            const float *q,
+                                                            const CscMatrix<float> *A,
+                                                            const float *b,
+                                                            uintptr_t n_cones,
+                                                            const SupportedConeT<float> *cones);
+RustDefaultSolverHandle_f64 clarabel_SolverPool_f64_acquire_i32(RustSolverPoolHandle_f64 pool,
+                                                                const CscMatrix32<double> *P,
+                                                                const double *q,
+                                                                const CscMatrix32<double> *A,
+                                                                const double *b,
+                                                                uintptr_t n_cones,
+                                                                const SupportedConeT<double> *cones);
+RustDefaultSolverHandle_f32 clarabel_SolverPool_f32_acquire_i32(RustSolverPoolHandle_f32 pool,
+                                                                const CscMatrix32<float> *P,
+                                                                const float *q,
+                                                                const CscMatrix32<float> *A,
+                                                                const float *b,
+                                                                uintptr_t n_cones,
+                                                                const SupportedConeT<float> *cones);
+
+void clarabel_SolverPool_f64_release(RustSolverPoolHandle_f64 pool, RustDefaultSolverHandle_f64 solver);
+void clarabel_SolverPool_f32_release(RustSolverPoolHandle_f32 pool, RustDefaultSolverHandle_f32 solver);
+uintptr_t clarabel_SolverPool_f64_idle_count(RustSolverPoolHandle_f64 pool);
+uintptr_t clarabel_SolverPool_f32_idle_count(RustSolverPoolHandle_f32 pool);
+} // extern "C"
+
+// Recycles solvers for problems with the same structure.
+//
+// Released solvers are kept by the pool, keyed by the dimensions and sparsity patterns of P and A and by the cones.
+// acquire() hands one back out for a problem with the same structure, rebinding it to the new numeric data through
+// the data update path so that the KKT, factorisation, cone and residual workspace are reused.  When no released
+// solver fits, a new one is built.  All solvers of a pool use the settings the pool was created with.  A pool must
+// not be used from several threads at once.
+template<typename T = double>
+class SolverPool
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "T must be float or double");
+
+  private:
+    using ConvertedCscMatrix = typename DefaultSolver<T>::ConvertedCscMatrix;
+    using ConvertedCscMatrix32 = typename DefaultSolver<T>::ConvertedCscMatrix32;
+
+    RustObjectHandle handle = nullptr;
+
+    static RustObjectHandle create_pool(const DefaultSettings<T> &settings, uintptr_t max_idle);
+    void free_pool();
+    RustObjectHandle acquire_handle(const ConvertedCscMatrix &P,
+                                    const T *q,
+                                    const ConvertedCscMatrix &A,
+                                    const T *b,
+                                    const std::vector<SupportedConeT<T>> &cones);
+    RustObjectHandle acquire_handle(const ConvertedCscMatrix32 &P,
+                                    const T *q,
+                                    const ConvertedCscMatrix32 &A,
+                                    const T *b,
+                                    const std::vector<SupportedConeT<T>> &cones);
+    void release_handle(RustObjectHandle solver);
+
+  public:
+    // max_idle bounds the number of released solvers kept for reuse, 0 for no limit
+    explicit SolverPool(const DefaultSettings<T> &settings, uintptr_t max_idle = 0)
+        : handle(create_pool(settings, max_idle))
+    {
+    }
+    ~SolverPool() { free_pool(); }
+
+    SolverPool(const SolverPool &) = delete;
+    SolverPool &operator=(const SolverPool &) = delete;
+    SolverPool(SolverPool &&other) : handle(other.handle) { other.handle = nullptr; }
+    SolverPool &operator=(SolverPool &&other)
+    {
+        if (this != &other)
+        {
+            free_pool();
+            handle = other.handle;
+            other.handle = nullptr;
+        }
+        return *this;
+    }
+
+    // A solver for the problem, recycled when possible.  Throws std::invalid_argument for inconsistent dimensions
+    // and std::runtime_error if a new solver cannot be built.
+    template<typename StorageIndex>
+    DefaultSolver<T> acquire(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                             const Eigen::Ref<Eigen::VectorX<T>> &q,
+                             const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                             const Eigen::Ref<Eigen::VectorX<T>> &b,
+                             const std::vector<SupportedConeT<T>> &cones);
+
+    // Hand a solver back for reuse.  The solver is left empty.  Termination callbacks, iteration observers,
+    // cancellation tokens and fixed buffer print targets are detached.
+    void release(DefaultSolver<T> &&solver);
+
+    // number of released solvers currently held
+    uintptr_t idle() const;
+};
+
+template<typename T>
+template<typename StorageIndex>
+inline DefaultSolver<T> SolverPool<T>::acquire(const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &P,
+                                               const Eigen::Ref<Eigen::VectorX<T>> &q,
+                                               const Eigen::SparseMatrix<T, Eigen::ColMajor, StorageIndex> &A,
+                                               const Eigen::Ref<Eigen::VectorX<T>> &b,
+                                               const std::vector<SupportedConeT<T>> &cones)
+{
+    DefaultSolver<T>::check_dimensions(P, q, A, b, cones);
+
+    typename DefaultSolver<T>::template ConvertedFor<StorageIndex> matrix_P = DefaultSolver<T>::eigen_sparse_to_clarabel(P);
+    typename DefaultSolver<T>::template ConvertedFor<StorageIndex> matrix_A = DefaultSolver<T>::eigen_sparse_to_clarabel(A);
+
+    RustObjectHandle solver = acquire_handle(matrix_P, q.data(), matrix_A, b.data(), cones);
+    if (solver == nullptr)
+    {
+        throw std::runtime_error("Failed to build solver");
+    }
+    return DefaultSolver<T>(solver);
+}
+
+template<typename T>
+inline void SolverPool<T>::release(DefaultSolver<T> &&solver)
+{
+    release_handle(solver.handle);
+    solver.handle = nullptr;
+}
+
+template<>
+inline RustObjectHandle SolverPool<double>::create_pool(const DefaultSettings<double> &settings, uintptr_t max_idle)
+{
+    return clarabel_SolverPool_f64_new(&settings, max_idle);
+}
+
+template<>
+inline RustObjectHandle SolverPool<float>::create_pool(const DefaultSettings<float> &settings, uintptr_t max_idle)
+{
+    return clarabel_SolverPool_f32_new(&settings, max_idle);
+}
+
+template<>
+inline void SolverPool<double>::free_pool()
+{
+    if (handle != nullptr)
+    {
+        clarabel_SolverPool_f64_free(handle);
+    }
+}
+
+template<>
+inline void SolverPool<float>::free_pool()
+{
+    if (handle != nullptr)
+    {
+        clarabel_SolverPool_f32_free(handle);
+    }
+}
+
+template<>
+inline RustObjectHandle SolverPool<double>::acquire_handle(const ConvertedCscMatrix &P,
+                                                           const double *q,
+                                                           const ConvertedCscMatrix &A,
+                                                           const double *b,
+                                                           const std::vector<SupportedConeT<double>> &cones)
+{
+    CscMatrix<double> p = P.as_csc();
+    CscMatrix<double> a = A.as_csc();
+    return clarabel_SolverPool_f64_acquire(handle, &p, q, &a, b, cones.size(), cones.data());
+}
+
+template<>
+inline RustObjectHandle SolverPool<float>::acquire_handle(const ConvertedCscMatrix &P,
+                                                          const float *q,
+                                                          const ConvertedCscMatrix &A,
+                                                          const float *b,
+                                                          const std::vector<SupportedConeT<float>> &cones)
+{
+    CscMatrix<float> p = P.as_csc();
+    CscMatrix<float> a = A.as_csc();
+    return clarabel_SolverPool_f32_acquire(handle, &p, q, &a, b, cones.size(), cones.data());
+}
+
+template<>
+inline RustObjectHandle SolverPool<double>::acquire_handle(const ConvertedCscMatrix32 &P,
+                                                           const double *q,
+                                                           const ConvertedCscMatrix32 &A,
+                                                           const double *b,
+                                                           const std::vector<SupportedConeT<double>> &cones)
+{
+    CscMatrix32<double> p = P.as_csc();
+    CscMatrix32<double> a = A.as_csc();
+    return clarabel_SolverPool_f64_acquire_i32(handle, &p, q, &a, b, cones.size(), cones.data());
+}
+
+template<>
+inline RustObjectHandle SolverPool<float>::acquire_handle(const ConvertedCscMatrix32 &P,
+                                                          const float *q,
+                                                          const ConvertedCscMatrix32 &A,
+                                                          const float *b,
+                                                          const std::vector<SupportedConeT<float>> &cones)
+{
+    CscMatrix32<float> p = P.as_csc();
+    CscMatrix32<float> a = A.as_csc();
+    return clarabel_SolverPool_f32_acquire_i32(handle, &p, q, &a, b, cones.size(), cones.data());
+}
+
+template<>
+inline void SolverPool<double>::release_handle(RustObjectHandle solver)
+{
+    clarabel_SolverPool_f64_release(handle, solver);
+}
+
+template<>
+inline void SolverPool<float>::release_handle(RustObjectHandle solver)
+{
+    clarabel_SolverPool_f32_release(handle, solver);
+}
+
+template<>
+inline uintptr_t SolverPool<double>::idle() const
+{
+    return clarabel_SolverPool_f64_idle_count(handle);
+}
+
+template<>
+inline uintptr_t SolverPool<float>::idle() const
+{
+    return clarabel_SolverPool_f32_idle_count(handle);
+}
+
+} // namespace clarabel
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+namespace clarabel
+{
+
+extern "C" {
+void clarabel_set_global_thread_pool(uintptr_t n_threads);
+uintptr_t clarabel_global_thread_pool();
+void clarabel_set_solver_thread_budget(uint32_t max_threads);
+uint32_t clarabel_solver_thread_budget();
+} // extern "C"
+
+// Process-wide thread settings.
+//
+// The global thread count bounds the worker threads shared by DefaultSolver::solve_async and is the default thread
+// count of BatchSolver.  The solver thread budget is the max_threads given to the linear solver of each solver built
+// while it is set, when its settings leave max_threads at 0; the linear solver takes its thread count when the solver
+// is built, so it cannot be changed for an existing solver, and a solver read with DefaultSolver::load_from_file keeps
+// the max_threads saved in the file.  Together they bound the threads used by overlapping
+// solves to about global_thread_pool() * solver_thread_budget().
+
+// n_threads = 0 restores one thread per available core.  Workers above a lowered count retire after their current solve.
+inline void set_global_thread_pool(uintptr_t n_threads)
+{
+    clarabel_set_global_thread_pool(n_threads);
+}
+
+inline uintptr_t global_thread_pool()
+{
+    return clarabel_global_thread_pool();
+}
+
+// max_threads = 0 leaves the choice to the linear solver
+inline void set_solver_thread_budget(uint32_t max_threads)
+{
+    clarabel_set_solver_thread_budget(max_threads);
+}
+
+inline uint32_t solver_thread_budget()
+{
+    return clarabel_solver_thread_budget();
+}
+
+} // namespace clarabel
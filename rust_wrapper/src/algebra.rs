@@ -1,3 +1,5 @@
+#![allow(non_camel_case_types)]
+
 use clarabel::algebra::FloatT;
 
 #[repr(C)]
@@ -60,3 +62,61 @@ pub unsafe extern "C" fn clarabel_CscMatrix_f64_init(
 ) {
     _internal_Cscmatrix_init::<f64>(ptr, m, n, colptr, rowval, nzval);
 }
+
+#[repr(C)]
+// CSC matrix with 32-bit indices, for C callers whose index arrays are already int32.
+// Indices are widened once on the Rust side instead of by the caller.
+pub struct ClarabelCscMatrix_i32<T = f64> {
+    /// number of rows
+    pub m: usize,
+    /// number of columns
+    pub n: usize,
+    /// CSC format column pointer, length `n+1`
+    pub colptr: *const i32,
+    /// vector of row indices
+    pub rowval: *const i32,
+    /// vector of non-zero matrix elements
+    pub nzval: *const T,
+}
+
+#[allow(non_snake_case)]
+unsafe fn _internal_Cscmatrix_i32_init<T: FloatT>(
+    ptr: *mut ClarabelCscMatrix_i32<T>,
+    m: usize,
+    n: usize,
+    colptr: *const i32,
+    rowval: *const i32,
+    nzval: *const T,
+) {
+    *ptr = ClarabelCscMatrix_i32::<T> {
+        m,
+        n,
+        colptr,
+        rowval,
+        nzval,
+    };
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f32_i32_init(
+    ptr: *mut ClarabelCscMatrix_i32<f32>,
+    m: usize,
+    n: usize,
+    colptr: *const i32,
+    rowval: *const i32,
+    nzval: *const f32,
+) {
+    _internal_Cscmatrix_i32_init::<f32>(ptr, m, n, colptr, rowval, nzval);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f64_i32_init(
+    ptr: *mut ClarabelCscMatrix_i32<f64>,
+    m: usize,
+    n: usize,
+    colptr: *const i32,
+    rowval: *const i32,
+    nzval: *const f64,
+) {
+    _internal_Cscmatrix_i32_init::<f64>(ptr, m, n, colptr, rowval, nzval);
+}
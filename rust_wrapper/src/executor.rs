@@ -0,0 +1,129 @@
+//! Process-wide worker threads for work submitted from C and C++ that must not
+//! block the calling thread.
+//!
+//! Workers are started on demand, up to the global thread count, and then stay
+//! alive waiting for further jobs.  Jobs run in submission order.
+//!
+//! Also holds the process-wide thread settings: the global thread count, which
+//! bounds these workers and the default size of batch solves, and the default
+//! thread budget of the linear solver of each new solver.
+
+use std::collections::VecDeque;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::atomic::{AtomicU32, AtomicUsize, Ordering};
+use std::sync::{Condvar, Mutex, OnceLock};
+use std::thread;
+
+type Job = Box<dyn FnOnce() + Send + 'static>;
+
+struct Queue {
+    jobs: VecDeque<Job>,
+    workers: usize,
+    idle: usize,
+}
+
+struct Executor {
+    queue: Mutex<Queue>,
+    ready: Condvar,
+}
+
+static EXECUTOR: Executor = Executor {
+    queue: Mutex::new(Queue {
+        jobs: VecDeque::new(),
+        workers: 0,
+        idle: 0,
+    }),
+    ready: Condvar::new(),
+};
+
+// 0 for one thread per available core
+static GLOBAL_THREADS: AtomicUsize = AtomicUsize::new(0);
+
+// available cores, queried once: the query reads the affinity mask and cgroup
+// limits, and the thread count is checked for every job under the queue lock
+static CORES: OnceLock<usize> = OnceLock::new();
+
+// 0 to leave max_threads of new solvers unchanged
+static SOLVER_THREADS: AtomicU32 = AtomicU32::new(0);
+
+/// Number of threads shared by asynchronous and batch solves
+pub(crate) fn global_threads() -> usize {
+    match GLOBAL_THREADS.load(Ordering::Relaxed) {
+        0 => *CORES.get_or_init(|| thread::available_parallelism().map_or(1, |n| n.get())),
+        n => n,
+    }
+}
+
+/// max_threads for a new solver whose settings ask for the default of 0
+pub(crate) fn solver_threads(max_threads: u32) -> u32 {
+    match max_threads {
+        0 => SOLVER_THREADS.load(Ordering::Relaxed),
+        n => n,
+    }
+}
+
+fn worker() {
+    let mut queue = EXECUTOR.queue.lock().unwrap();
+    loop {
+        // workers beyond a lowered thread count retire between jobs
+        if queue.workers > global_threads() {
+            queue.workers -= 1;
+            return;
+        }
+        match queue.jobs.pop_front() {
+            Some(job) => {
+                drop(queue);
+                // a panicking job must not take the worker down with it
+                let _ = panic::catch_unwind(AssertUnwindSafe(job));
+                queue = EXECUTOR.queue.lock().unwrap();
+            }
+            None => {
+                queue.idle += 1;
+                queue = EXECUTOR.ready.wait(queue).unwrap();
+                queue.idle -= 1;
+            }
+        }
+    }
+}
+
+/// Queue a job to run on a worker thread
+pub(crate) fn spawn(job: impl FnOnce() + Send + 'static) {
+    let mut queue = EXECUTOR.queue.lock().unwrap();
+    queue.jobs.push_back(Box::new(job));
+    if queue.idle < queue.jobs.len() && queue.workers < global_threads() {
+        if thread::Builder::new()
+            .name("clarabel-worker".into())
+            .spawn(worker)
+            .is_ok()
+        {
+            queue.workers += 1;
+        }
+    }
+    drop(queue);
+    EXECUTOR.ready.notify_one();
+}
+
+/// Set the number of threads shared by asynchronous and batch solves, 0 for one
+/// per available core.  Workers above a lowered count retire after their
+/// current job.
+#[no_mangle]
+pub extern "C" fn clarabel_set_global_thread_pool(n_threads: usize) {
+    GLOBAL_THREADS.store(n_threads, Ordering::Relaxed);
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_global_thread_pool() -> usize {
+    global_threads()
+}
+
+/// Set max_threads for solvers built afterwards with max_threads = 0, 0 to leave
+/// the choice to the linear solver
+#[no_mangle]
+pub extern "C" fn clarabel_set_solver_thread_budget(max_threads: u32) {
+    SOLVER_THREADS.store(max_threads, Ordering::Relaxed);
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_solver_thread_budget() -> u32 {
+    SOLVER_THREADS.load(Ordering::Relaxed)
+}
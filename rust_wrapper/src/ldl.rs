@@ -0,0 +1,195 @@
+#![allow(non_snake_case)]
+#![allow(non_camel_case_types)]
+
+//! Sparse LDL factorisation of quasidefinite matrices, using the QDLDL solver
+//! that Clarabel.rs uses for its KKT systems.
+
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
+use crate::utils;
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::qdldl::{QDLDLFactorisation, QDLDLSettings};
+use std::ffi::c_void;
+use std::mem::forget;
+use std::slice;
+
+pub type ClarabelLdlSolver_f64 = c_void;
+pub type ClarabelLdlSolver_f32 = c_void;
+
+struct LdlSolver<T: FloatT> {
+    factors: QDLDLFactorisation<T>,
+    n: usize,
+    nnz: usize,
+    // 0..nnz, for replacing all values at once
+    all: Vec<usize>,
+}
+
+impl<T: FloatT> LdlSolver<T> {
+    unsafe fn from_raw<'a>(ptr: *mut c_void) -> &'a mut Self {
+        &mut *(ptr as *mut Self)
+    }
+}
+
+unsafe fn _factor<T: FloatT>(K: &CscMatrix<T>, Dsigns: *const i8) -> *mut c_void {
+    if K.m != K.n {
+        return std::ptr::null_mut();
+    }
+    let mut settings = QDLDLSettings::<T>::default();
+    if Dsigns.is_null() {
+        // regularization needs the expected signs
+        settings.regularize_enable = false;
+    } else {
+        let Dsigns = slice::from_raw_parts(Dsigns, K.n);
+        if Dsigns.iter().any(|&s| s != 1 && s != -1) {
+            return std::ptr::null_mut();
+        }
+        settings.Dsigns = Some(Dsigns.to_vec());
+    }
+    match QDLDLFactorisation::new(K, Some(settings)) {
+        Ok(factors) => {
+            let nnz = K.colptr[K.n];
+            let solver = LdlSolver {
+                factors,
+                n: K.n,
+                nnz,
+                all: Vec::new(),
+            };
+            Box::into_raw(Box::new(solver)) as *mut c_void
+        }
+        Err(_) => std::ptr::null_mut(),
+    }
+}
+
+unsafe fn _internal_LdlSolver_new<T: FloatT>(K: *const ClarabelCscMatrix<T>, Dsigns: *const i8) -> *mut c_void {
+    let K = utils::convert_from_C_CscMatrix(K);
+    let solver = _factor(&K, Dsigns);
+
+    // Ensure Rust does not free the memory of arrays managed by C
+    forget(K);
+    solver
+}
+
+unsafe fn _internal_LdlSolver_new_i32<T: FloatT>(K: *const ClarabelCscMatrix_i32<T>, Dsigns: *const i8) -> *mut c_void {
+    let K = utils::convert_from_C_CscMatrix_i32(K);
+    let solver = _factor(&K, Dsigns);
+    utils::release_C_CscMatrix_i32(K);
+    solver
+}
+
+unsafe fn _internal_LdlSolver_free<T: FloatT>(solver: *mut c_void) {
+    if !solver.is_null() {
+        drop(Box::from_raw(solver as *mut LdlSolver<T>));
+    }
+}
+
+unsafe fn _internal_LdlSolver_update_values<T: FloatT>(
+    solver: *mut c_void,
+    index: *const usize,
+    values: *const T,
+    nvals: usize,
+) {
+    let solver = LdlSolver::<T>::from_raw(solver);
+    if nvals == 0 {
+        return;
+    }
+    let index = slice::from_raw_parts(index, nvals);
+    let values = slice::from_raw_parts(values, nvals);
+    solver.factors.update_values(index, values);
+}
+
+unsafe fn _internal_LdlSolver_refactor<T: FloatT>(solver: *mut c_void, nzval: *const T, nnz: usize) -> bool {
+    let solver = LdlSolver::<T>::from_raw(solver);
+    if !nzval.is_null() {
+        if nnz != solver.nnz {
+            return false;
+        }
+        if solver.all.len() != nnz {
+            solver.all = (0..nnz).collect();
+        }
+        solver.factors.update_values(&solver.all, slice::from_raw_parts(nzval, nnz));
+    }
+    solver.factors.refactor().is_ok()
+}
+
+unsafe fn _internal_LdlSolver_solve<T: FloatT>(solver: *mut c_void, b: *mut T, nrhs: usize) {
+    let solver = LdlSolver::<T>::from_raw(solver);
+    if solver.n == 0 || nrhs == 0 {
+        return;
+    }
+    let b = slice::from_raw_parts_mut(b, solver.n * nrhs);
+    for rhs in b.chunks_exact_mut(solver.n) {
+        solver.factors.solve(rhs);
+    }
+}
+
+unsafe fn _internal_LdlSolver_positive_inertia<T: FloatT>(solver: *mut c_void) -> usize {
+    LdlSolver::<T>::from_raw(solver).factors.positive_inertia()
+}
+
+macro_rules! _make_clarabel_LdlSolver {
+    ($TYPE:ty, $SUFFIX:ident) => {
+        paste::paste! {
+            /// Factor an upper triangular quasidefinite matrix.  Dsigns, if not null,
+            /// holds the expected sign (+1 or -1) of each pivot and enables regularization.
+            /// Returns null if the matrix is not square and upper triangular, if a sign is
+            /// not +1 or -1, or if the matrix cannot be factored.
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _new>](
+                K: *const ClarabelCscMatrix<$TYPE>,
+                Dsigns: *const i8,
+            ) -> *mut [<ClarabelLdlSolver_ $SUFFIX>] {
+                _internal_LdlSolver_new::<$TYPE>(K, Dsigns)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _new_i32>](
+                K: *const ClarabelCscMatrix_i32<$TYPE>,
+                Dsigns: *const i8,
+            ) -> *mut [<ClarabelLdlSolver_ $SUFFIX>] {
+                _internal_LdlSolver_new_i32::<$TYPE>(K, Dsigns)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _free>](solver: *mut [<ClarabelLdlSolver_ $SUFFIX>]) {
+                _internal_LdlSolver_free::<$TYPE>(solver)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _update_values>](
+                solver: *mut [<ClarabelLdlSolver_ $SUFFIX>],
+                index: *const usize,
+                values: *const $TYPE,
+                nvals: usize,
+            ) {
+                _internal_LdlSolver_update_values::<$TYPE>(solver, index, values, nvals)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _refactor>](
+                solver: *mut [<ClarabelLdlSolver_ $SUFFIX>],
+                nzval: *const $TYPE,
+                nnz: usize,
+            ) -> bool {
+                _internal_LdlSolver_refactor::<$TYPE>(solver, nzval, nnz)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _solve>](
+                solver: *mut [<ClarabelLdlSolver_ $SUFFIX>],
+                b: *mut $TYPE,
+                nrhs: usize,
+            ) {
+                _internal_LdlSolver_solve::<$TYPE>(solver, b, nrhs)
+            }
+
+            #[no_mangle]
+            pub unsafe extern "C" fn [<clarabel_LdlSolver_ $SUFFIX _positive_inertia>](
+                solver: *mut [<ClarabelLdlSolver_ $SUFFIX>],
+            ) -> usize {
+                _internal_LdlSolver_positive_inertia::<$TYPE>(solver)
+            }
+        }
+    };
+}
+
+_make_clarabel_LdlSolver!(f64, f64);
+_make_clarabel_LdlSolver!(f32, f32);
@@ -1,4 +1,7 @@
 mod algebra;
 mod core;
+mod executor;
+mod ldl;
 mod solver;
+mod structure;
 mod utils;
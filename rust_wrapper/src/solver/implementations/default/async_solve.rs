@@ -0,0 +1,79 @@
+#![allow(non_snake_case)]
+#![allow(non_camel_case_types)]
+
+use super::handle::DefaultSolverHandle;
+use super::info::ClarabelDefaultInfo;
+use super::solver::*;
+use crate::executor;
+use clarabel::algebra::FloatT;
+use std::ffi::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::ptr;
+
+pub(crate) type SolveCompletionFFI<T> =
+    extern "C" fn(solver: *mut c_void, info: *const ClarabelDefaultInfo<T>, userdata: *mut c_void);
+pub type ClarabelSolveCompletion_f64 = SolveCompletionFFI<f64>;
+pub type ClarabelSolveCompletion_f32 = SolveCompletionFFI<f32>;
+
+// A solve queued on the executor.  The caller hands the solver over until the
+// completion callback runs, so it is never accessed from two threads at once.
+struct AsyncSolve<T> {
+    solver: *mut c_void,
+    completion: Option<SolveCompletionFFI<T>>,
+    userdata: *mut c_void,
+}
+unsafe impl<T> Send for AsyncSolve<T> {}
+
+impl<T: FloatT> AsyncSolve<T> {
+    fn run(self) {
+        // a panicking solve still completes, with no info, so that the caller is
+        // never left waiting for a completion that does not come
+        let info = panic::catch_unwind(AssertUnwindSafe(|| {
+            // Recover the solver object from the opaque pointer
+            let solver = unsafe { DefaultSolverHandle::<T>::from_raw(self.solver) };
+            solver.solve();
+            ClarabelDefaultInfo::<T>::from(solver.info.clone())
+        }));
+
+        if let Some(completion) = self.completion {
+            let info = match &info {
+                Ok(info) => info as *const ClarabelDefaultInfo<T>,
+                Err(_) => ptr::null(),
+            };
+            completion(self.solver, info, self.userdata);
+        }
+    }
+}
+
+/// Solve on a worker thread of the executor and report the result through the
+/// completion callback, which runs on that worker thread
+fn _internal_DefaultSolver_solve_async<T: FloatT + 'static>(
+    solver: *mut c_void,
+    completion: Option<SolveCompletionFFI<T>>,
+    userdata: *mut c_void,
+) {
+    let task = AsyncSolve::<T> {
+        solver,
+        completion,
+        userdata,
+    };
+    executor::spawn(move || task.run());
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_solve_async(
+    solver: *mut ClarabelDefaultSolver_f64,
+    completion: Option<ClarabelSolveCompletion_f64>,
+    userdata: *mut c_void,
+) {
+    _internal_DefaultSolver_solve_async::<f64>(solver, completion, userdata)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_solve_async(
+    solver: *mut ClarabelDefaultSolver_f32,
+    completion: Option<ClarabelSolveCompletion_f32>,
+    userdata: *mut c_void,
+) {
+    _internal_DefaultSolver_solve_async::<f32>(solver, completion, userdata)
+}
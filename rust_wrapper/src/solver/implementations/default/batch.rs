@@ -0,0 +1,137 @@
+#![allow(non_snake_case)]
+
+use super::handle::DefaultSolverHandle;
+use super::info::ClarabelDefaultInfo;
+use super::solver::*;
+use crate::executor;
+use clarabel::algebra::FloatT;
+use std::ffi::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, Condvar, Mutex};
+
+// Upper bound on the number of solvers a worker claims from the shared queue at once.
+// Claiming in chunks keeps contention on the queue counter low for very small problems,
+// while the bound keeps the tail of the batch balanced across workers.
+const MAX_CHUNK_SIZE: usize = 16;
+
+// A batch being solved by the calling thread and by helper jobs on the executor.
+// Each index is claimed by exactly one thread, so no solver is ever accessed from
+// two threads at once, and threads write disjoint entries of the info array.
+struct Batch<T> {
+    solvers: *const *mut c_void,
+    info: *mut ClarabelDefaultInfo<T>,
+    n_solvers: usize,
+    chunk_size: usize,
+    next: AtomicUsize,
+    // solvers finished so far; the caller returns once all of them are
+    done: Mutex<usize>,
+    finished: Condvar,
+}
+unsafe impl<T> Send for Batch<T> {}
+unsafe impl<T> Sync for Batch<T> {}
+
+impl<T: FloatT> Batch<T> {
+    // Claim and solve chunks until none are left.  A helper that starts after the
+    // batch is complete finds nothing to claim and never touches the arrays.
+    fn work(&self) {
+        loop {
+            let start = self.next.fetch_add(self.chunk_size, Ordering::Relaxed);
+            if start >= self.n_solvers {
+                return;
+            }
+            let end = (start + self.chunk_size).min(self.n_solvers);
+            for k in start..end {
+                unsafe { self.solve(k) };
+            }
+            let mut done = self.done.lock().unwrap();
+            *done += end - start;
+            if *done == self.n_solvers {
+                self.finished.notify_all();
+            }
+        }
+    }
+
+    unsafe fn solve(&self, k: usize) {
+        let solver = *self.solvers.add(k);
+        if solver.is_null() {
+            return;
+        }
+        // a panicking solve leaves its info entry untouched instead of unwinding into C
+        let info = panic::catch_unwind(AssertUnwindSafe(|| {
+            // Recover the solver object from the opaque pointer
+            let solver = DefaultSolverHandle::<T>::from_raw(solver);
+            solver.solve();
+            ClarabelDefaultInfo::<T>::from(solver.info.clone())
+        }));
+        if let (Ok(info), false) = (info, self.info.is_null()) {
+            self.info.add(k).write(info);
+        }
+    }
+}
+
+/// Solve a batch of independent solvers in parallel
+///
+/// The calling thread and up to n_threads - 1 helper jobs on the shared executor
+/// repeatedly claim the next chunk of unsolved problems from a shared counter, so
+/// threads that finish early pick up the remaining work.  The caller does not wait
+/// for helpers to start: if the workers are busy it solves the batch itself.  The
+/// info for solver k is written to `info[k]` if `info` is not null.
+unsafe fn _internal_BatchSolve<T: FloatT + 'static>(
+    solvers: *const *mut c_void,
+    n_solvers: usize,
+    n_threads: usize,
+    info: *mut ClarabelDefaultInfo<T>,
+) {
+    if solvers.is_null() || n_solvers == 0 {
+        return;
+    }
+
+    // Use the global thread count if the thread count is not specified
+    let n_threads = match n_threads {
+        0 => executor::global_threads(),
+        n => n,
+    }
+    .min(n_solvers);
+
+    let batch = Arc::new(Batch {
+        solvers,
+        info,
+        n_solvers,
+        chunk_size: (n_solvers / (4 * n_threads)).clamp(1, MAX_CHUNK_SIZE),
+        next: AtomicUsize::new(0),
+        done: Mutex::new(0),
+        finished: Condvar::new(),
+    });
+    for _ in 1..n_threads {
+        let batch = Arc::clone(&batch);
+        executor::spawn(move || batch.work());
+    }
+    batch.work();
+
+    // wait for the chunks still being solved by helpers
+    let mut done = batch.done.lock().unwrap();
+    while *done < n_solvers {
+        done = batch.finished.wait(done).unwrap();
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_BatchSolve_f64(
+    solvers: *const *mut ClarabelDefaultSolver_f64,
+    n_solvers: usize,
+    n_threads: usize,
+    info: *mut ClarabelDefaultInfo<f64>,
+) {
+    _internal_BatchSolve::<f64>(solvers, n_solvers, n_threads, info);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_BatchSolve_f32(
+    solvers: *const *mut ClarabelDefaultSolver_f32,
+    n_solvers: usize,
+    n_threads: usize,
+    info: *mut ClarabelDefaultInfo<f32>,
+) {
+    _internal_BatchSolve::<f32>(solvers, n_solvers, n_threads, info);
+}
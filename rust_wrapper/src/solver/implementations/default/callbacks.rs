@@ -4,8 +4,12 @@
 use super::solver::*;
 use crate::solver::implementations::default::info::ClarabelDefaultInfo;
 use clarabel::algebra::FloatT;
-use clarabel::solver::{self as lib};
+use clarabel::solver as lib;
+use super::handle::DefaultSolverHandle;
 use std::ffi::{c_int, c_void};
+use std::sync::atomic::{fence, AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::Instant;
 
 pub(crate) type CallbackFcnFFI<T> =
     extern "C" fn(info: *const ClarabelDefaultInfo<T>, userdata: *mut std::ffi::c_void) -> c_int;
@@ -19,10 +23,11 @@ fn _internal_DefaultSolver_set_termination_callback<T: FloatT>(
     userdata: *mut std::ffi::c_void,
 ) {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Set the termination callback
-    solver.set_termination_callback_c(callback, userdata);
+    solver.termination = Some((callback, userdata));
+    _install_callbacks(solver);
 }
 
 #[no_mangle]
@@ -46,10 +51,11 @@ pub extern "C" fn clarabel_DefaultSolver_f32_set_termination_callback(
 /// Turn off the termination callback
 fn _internal_DefaultSolver_unset_termination_callback<T: FloatT>(solver: *mut c_void) {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Set the termination callback
-    solver.unset_termination_callback();
+    solver.termination = None;
+    _install_callbacks(solver);
 }
 
 #[no_mangle]
@@ -65,3 +71,188 @@ pub extern "C" fn clarabel_DefaultSolver_f32_unset_termination_callback(
 ) {
     _internal_DefaultSolver_unset_termination_callback::<f32>(solver)
 }
+
+/// Per-iteration progress record written by the iteration observer
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct ClarabelIterationRecord<T> {
+    /// Seconds since the start of the current solve
+    pub elapsed: f64,
+    pub iteration: u32,
+    pub mu: T,
+    pub sigma: T,
+    pub step_length: T,
+    pub cost_primal: T,
+    pub cost_dual: T,
+    pub res_primal: T,
+    pub res_dual: T,
+    pub res_primal_inf: T,
+    pub res_dual_inf: T,
+    pub gap_abs: T,
+    pub gap_rel: T,
+    pub ktratio: T,
+}
+
+/// Caller-owned ring buffer of iteration records.
+///
+/// Record k of the solver's lifetime is written to `records[k % capacity]`,
+/// after which `head` is set to k+1 with release ordering.  A slot holds record
+/// k only until record k + capacity overwrites it, without any check on
+/// readers, so a record copied during a solve is intact only if `head`, loaded
+/// again after the copy, is below k + capacity.  While a solve may be running,
+/// readers load `head` through `clarabel_IterationRing_*_load_head` and must
+/// not change `records` or `capacity`.
+///
+/// `head` is atomic, which also gives it the 8-byte alignment that `u64` lacks
+/// on some 32-bit targets.
+#[repr(C)]
+pub struct ClarabelIterationRing<T> {
+    pub records: *mut ClarabelIterationRecord<T>,
+    pub capacity: usize,
+    pub head: AtomicU64,
+}
+
+pub type ClarabelIterationRing_f64 = ClarabelIterationRing<f64>;
+pub type ClarabelIterationRing_f32 = ClarabelIterationRing<f32>;
+
+/// Writes iteration records into a caller-owned ring without allocating
+pub(crate) struct IterationObserver<T> {
+    ring: *mut ClarabelIterationRing<T>,
+    base: Instant,
+    solve_start_ns: AtomicU64,
+}
+
+// The ring is owned by the caller, who keeps it alive while it is attached
+// and never lets two solves write to the same ring concurrently.
+unsafe impl<T> Send for IterationObserver<T> {}
+unsafe impl<T> Sync for IterationObserver<T> {}
+
+impl<T: FloatT> IterationObserver<T> {
+    fn new(ring: *mut ClarabelIterationRing<T>) -> Self {
+        let base = Instant::now();
+        Self { ring, base, solve_start_ns: AtomicU64::new(0) }
+    }
+
+    /// Mark the start of a solve, from which record times are measured
+    pub fn start_solve(&self, start: Instant) {
+        let ns = start.saturating_duration_since(self.base).as_nanos() as u64;
+        self.solve_start_ns.store(ns, Ordering::Relaxed);
+    }
+
+    fn record(&self, info: &lib::DefaultInfo<T>) {
+        // the caller may be reading the ring concurrently, so its fields are
+        // accessed through the raw pointer rather than a unique reference
+        let ring = self.ring;
+        let (records, capacity) = unsafe { ((*ring).records, (*ring).capacity) };
+        if records.is_null() || capacity == 0 {
+            return;
+        }
+        let now_ns = self.base.elapsed().as_nanos() as u64;
+        let start_ns = self.solve_start_ns.load(Ordering::Relaxed);
+
+        let record = ClarabelIterationRecord {
+            elapsed: now_ns.saturating_sub(start_ns) as f64 * 1e-9,
+            iteration: info.iterations,
+            mu: info.mu,
+            sigma: info.sigma,
+            step_length: info.step_length,
+            cost_primal: info.cost_primal,
+            cost_dual: info.cost_dual,
+            res_primal: info.res_primal,
+            res_dual: info.res_dual,
+            res_primal_inf: info.res_primal_inf,
+            res_dual_inf: info.res_dual_inf,
+            gap_abs: info.gap_abs,
+            gap_rel: info.gap_rel,
+            ktratio: info.ktratio,
+        };
+
+        let head = unsafe { &(*ring).head };
+        let k = head.load(Ordering::Relaxed);
+
+        // the slot still holds record k - capacity, which a reader may be
+        // copying.  Order the previous head store before overwriting it, to
+        // pair with the fence in load_head, then publish the record before
+        // advancing head.
+        fence(Ordering::SeqCst);
+        unsafe {
+            records.add((k % capacity as u64) as usize).write(record);
+        }
+        head.store(k + 1, Ordering::Release);
+    }
+}
+
+/// Install the termination callback, iteration observer and cancellation token
+/// of a solver into the single callback slot of Clarabel.rs
+pub(crate) fn _install_callbacks<T: FloatT>(solver: &mut DefaultSolverHandle<T>) {
+    match (solver.termination, solver.observer.clone(), solver.cancel.clone()) {
+        (None, None, None) => solver.unset_termination_callback(),
+        (Some((callback, userdata)), None, None) => solver.set_termination_callback_c(callback, userdata),
+        (termination, observer, cancel) => solver.set_termination_callback(move |info: &lib::DefaultInfo<T>| {
+            if let Some(observer) = &observer {
+                observer.record(info);
+            }
+            if cancel.as_ref().is_some_and(|cancel| cancel.stop_requested()) {
+                return true;
+            }
+            match termination {
+                Some((callback, userdata)) => {
+                    let info: ClarabelDefaultInfo<T> = info.clone().into();
+                    callback(&info, userdata) != 0
+                }
+                None => false,
+            }
+        }),
+    }
+}
+
+/// Attach a caller-owned ring buffer that receives one record per iteration.
+/// A null ring detaches the observer.
+fn _internal_DefaultSolver_set_iteration_observer<T: FloatT>(
+    solver: *mut c_void,
+    ring: *mut ClarabelIterationRing<T>,
+) {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.observer = match ring.is_null() {
+        true => None,
+        false => Some(Arc::new(IterationObserver::new(ring))),
+    };
+    _install_callbacks(solver);
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_set_iteration_observer(
+    solver: *mut ClarabelDefaultSolver_f64,
+    ring: *mut ClarabelIterationRing_f64,
+) {
+    _internal_DefaultSolver_set_iteration_observer::<f64>(solver, ring)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_set_iteration_observer(
+    solver: *mut ClarabelDefaultSolver_f32,
+    ring: *mut ClarabelIterationRing_f32,
+) {
+    _internal_DefaultSolver_set_iteration_observer::<f32>(solver, ring)
+}
+
+/// Load the head of a ring with acquire ordering, so that the records below it
+/// can be read while a solve is writing to the ring.  The fence orders the
+/// caller's earlier copies of records before the load, so that a head loaded
+/// after a copy tells whether the record was overwritten meanwhile.
+unsafe fn _internal_IterationRing_load_head<T>(ring: *const ClarabelIterationRing<T>) -> u64 {
+    fence(Ordering::SeqCst);
+    (*ring).head.load(Ordering::Acquire)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_IterationRing_f64_load_head(ring: *const ClarabelIterationRing_f64) -> u64 {
+    _internal_IterationRing_load_head(ring)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_IterationRing_f32_load_head(ring: *const ClarabelIterationRing_f32) -> u64 {
+    _internal_IterationRing_load_head(ring)
+}
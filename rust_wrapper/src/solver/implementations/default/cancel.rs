@@ -0,0 +1,131 @@
+#![allow(non_snake_case)]
+
+use super::callbacks::_install_callbacks;
+use super::handle::DefaultSolverHandle;
+use super::solver::*;
+use clarabel::algebra::FloatT;
+use std::ffi::c_void;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::Instant;
+
+// deadline_ns value for no deadline
+const NO_DEADLINE: u64 = u64::MAX;
+
+/// Cooperative cancellation flag and deadline, polled by every solver it is
+/// attached to at each iteration boundary.  All methods may be called from any
+/// thread while solves are running.
+pub struct ClarabelCancelToken {
+    cancelled: AtomicBool,
+    base: Instant,
+    // nanoseconds after `base`
+    deadline_ns: AtomicU64,
+}
+
+impl ClarabelCancelToken {
+    fn new() -> Self {
+        Self {
+            cancelled: AtomicBool::new(false),
+            base: Instant::now(),
+            deadline_ns: AtomicU64::new(NO_DEADLINE),
+        }
+    }
+
+    /// True once the token has been cancelled or its deadline has passed
+    pub(crate) fn stop_requested(&self) -> bool {
+        if self.cancelled.load(Ordering::Relaxed) {
+            return true;
+        }
+        let deadline = self.deadline_ns.load(Ordering::Relaxed);
+        deadline != NO_DEADLINE && self.base.elapsed().as_nanos() as u64 >= deadline
+    }
+
+    fn set_deadline(&self, seconds: f64) {
+        let now = self.base.elapsed().as_nanos() as u64;
+        let deadline = match seconds > 0.0 {
+            true => now.saturating_add((seconds * 1e9).min(u64::MAX as f64) as u64),
+            false => now,
+        };
+        self.deadline_ns.store(deadline.min(NO_DEADLINE - 1), Ordering::Relaxed);
+    }
+}
+
+unsafe fn _token<'a>(token: *const ClarabelCancelToken) -> &'a ClarabelCancelToken {
+    &*token
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_CancelToken_new() -> *const ClarabelCancelToken {
+    Arc::into_raw(Arc::new(ClarabelCancelToken::new()))
+}
+
+/// Release the caller's reference.  Solvers the token is attached to keep their own.
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_free(token: *const ClarabelCancelToken) {
+    if !token.is_null() {
+        drop(Arc::from_raw(token));
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_cancel(token: *const ClarabelCancelToken) {
+    _token(token).cancelled.store(true, Ordering::Relaxed);
+}
+
+/// Clear the cancellation flag and the deadline
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_reset(token: *const ClarabelCancelToken) {
+    let token = _token(token);
+    token.cancelled.store(false, Ordering::Relaxed);
+    token.deadline_ns.store(NO_DEADLINE, Ordering::Relaxed);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_is_cancelled(token: *const ClarabelCancelToken) -> bool {
+    _token(token).stop_requested()
+}
+
+/// Stop solves at the first iteration boundary after `seconds` from now
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_set_deadline(token: *const ClarabelCancelToken, seconds: f64) {
+    _token(token).set_deadline(seconds);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CancelToken_clear_deadline(token: *const ClarabelCancelToken) {
+    _token(token).deadline_ns.store(NO_DEADLINE, Ordering::Relaxed);
+}
+
+/// Attach a cancellation token to a solver.  A null token detaches it.
+unsafe fn _internal_DefaultSolver_set_cancel_token<T: FloatT>(
+    solver: *mut c_void,
+    token: *const ClarabelCancelToken,
+) {
+    // Recover the solver object from the opaque pointer
+    let solver = DefaultSolverHandle::<T>::from_raw(solver);
+
+    solver.cancel = match token.is_null() {
+        true => None,
+        false => {
+            Arc::increment_strong_count(token);
+            Some(Arc::from_raw(token))
+        }
+    };
+    _install_callbacks(solver);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_set_cancel_token(
+    solver: *mut ClarabelDefaultSolver_f64,
+    token: *const ClarabelCancelToken,
+) {
+    _internal_DefaultSolver_set_cancel_token::<f64>(solver, token)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_set_cancel_token(
+    solver: *mut ClarabelDefaultSolver_f32,
+    token: *const ClarabelCancelToken,
+) {
+    _internal_DefaultSolver_set_cancel_token::<f32>(solver, token)
+}
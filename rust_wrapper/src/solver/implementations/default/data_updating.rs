@@ -1,10 +1,12 @@
-use crate::algebra::ClarabelCscMatrix;
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
 use crate::solver::implementations::default::solver::*;
+use crate::structure::{csc_indices, PatternIndex};
 use crate::utils;
 use core::iter::zip;
-use clarabel::algebra::FloatT;
-use clarabel::solver::{self as lib};
-use std::{ffi::c_void, mem::forget};
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::solver as lib;
+use crate::solver::implementations::default::handle::{DefaultSolverHandle, ProblemData};
+use std::{ffi::c_void, mem::forget, slice};
 use paste::paste;
 
 #[allow(non_camel_case_types)]
@@ -15,30 +17,207 @@ enum DataUpdateTarget{
     b,
 }
 
+// The values in the solver's copy of the problem data that an update targets
+fn _problem_values<'a, T: FloatT>(
+    problem: &'a mut ProblemData<T>,
+    method: &DataUpdateTarget
+) -> &'a mut [T] {
+    match method {
+        DataUpdateTarget::P => &mut problem.P.nzval,
+        DataUpdateTarget::A => &mut problem.A.nzval,
+        DataUpdateTarget::q => &mut problem.q,
+        DataUpdateTarget::b => &mut problem.b,
+    }
+}
+
+// Number of values of P, A, q or b held by the solver itself, which bounds the
+// indices of a partial update
+fn _solver_len<T: FloatT>(
+    solver: &lib::DefaultSolver<T>,
+    method: &DataUpdateTarget
+) -> usize {
+    match method {
+        DataUpdateTarget::P => solver.data.P.nzval.len(),
+        DataUpdateTarget::A => solver.data.A.nzval.len(),
+        DataUpdateTarget::q => solver.data.q.len(),
+        DataUpdateTarget::b => solver.data.b.len(),
+    }
+}
+
+// Apply an update to the solver's copy of the problem data.  If the update does
+// not map onto the copy, the copy is dropped and the solver can no longer be cloned.
+fn _sync_problem<T: FloatT>(
+    problem: &mut Option<ProblemData<T>>,
+    method: &DataUpdateTarget,
+    apply: impl FnOnce(&mut [T]) -> bool
+) {
+    if let Some(data) = problem.as_mut() {
+        if !apply(_problem_values(data, method)) {
+            *problem = None;
+        }
+    }
+}
+
+// Pass new values of P, A, q or b to the solver (full rewrite form)
+fn _update_values<T: FloatT>(
+    solver: &mut lib::DefaultSolver<T>,
+    values: &[T],
+    method: &DataUpdateTarget
+) {
+    match method {
+        DataUpdateTarget::P => solver.update_P(values).unwrap(),
+        DataUpdateTarget::A => solver.update_A(values).unwrap(),
+        DataUpdateTarget::q => solver.update_q(values).unwrap(),
+        DataUpdateTarget::b => solver.update_b(values).unwrap(),
+    }
+}
+
+// Pass new values for some entries of P, A, q or b to the solver (partial rewrite form)
+fn _update_partial<T: FloatT>(
+    solver: &mut lib::DefaultSolver<T>,
+    index: &[usize],
+    values: &[T],
+    method: &DataUpdateTarget
+) {
+    match method {
+        DataUpdateTarget::P => solver.update_P(&zip(index, values)).unwrap(),
+        DataUpdateTarget::A => solver.update_A(&zip(index, values)).unwrap(),
+        DataUpdateTarget::q => solver.update_q(&zip(index, values)).unwrap(),
+        DataUpdateTarget::b => solver.update_b(&zip(index, values)).unwrap(),
+    }
+}
+
+// Copy new values of P, A, q or b into the solver's copy of the problem data
+fn _sync_values<T: FloatT>(
+    problem: &mut Option<ProblemData<T>>,
+    values: &[T],
+    method: &DataUpdateTarget
+) {
+    _sync_problem(problem, method, |target| {
+        let ok = target.len() == values.len();
+        if ok {
+            target.copy_from_slice(values);
+        }
+        ok
+    });
+}
+
+// Update the values of P, A, q or b of a recovered solver (full rewrite form)
+fn _apply_values_update<T: FloatT>(
+    solver: &mut DefaultSolverHandle<T>,
+    values: &[T],
+    method: DataUpdateTarget
+) {
+    solver.timed_update(|solver| _update_values(solver, values, &method));
+    _sync_values(&mut solver.problem, values, &method);
+}
+
+// True if a CSC update of P or A keeps the pattern of the solver's current data,
+// so that it can be applied as a values-only update
+fn _same_stored_pattern<T: FloatT, I: PatternIndex>(
+    solver: &DefaultSolverHandle<T>,
+    (m, n, colptr, rowval): (usize, usize, &[I], &[I]),
+    method: &DataUpdateTarget
+) -> bool {
+    match (&solver.problem, method) {
+        (Some(problem), DataUpdateTarget::P) => problem.P.same_pattern(m, n, colptr, rowval),
+        (Some(problem), DataUpdateTarget::A) => problem.A.same_pattern(m, n, colptr, rowval),
+        _ => false,
+    }
+}
+
+// Update P or A of a recovered solver from a CSC matrix.  Returns false if the
+// solver pattern is locked and the new pattern differs, or the solver rejects it.
+fn _apply_csc_update<T: FloatT>(
+    solver: &mut DefaultSolverHandle<T>,
+    mat: &CscMatrix<T>,
+    method: DataUpdateTarget
+) -> bool {
+
+    // An unchanged pattern skips the pattern checks of the CSC form
+    if _same_stored_pattern(solver, (mat.m, mat.n, &mat.colptr[..], &mat.rowval[..]), &method) {
+        _apply_values_update(solver, &mat.nzval, method);
+        return true;
+    }
+
+    if !solver.check_pattern(mat, matches!(method, DataUpdateTarget::P)) {
+        return false;
+    }
+
+    let updated = solver.timed_update(|solver| match method {
+        DataUpdateTarget::P => solver.update_P(mat).is_ok(),
+        DataUpdateTarget::A => solver.update_A(mat).is_ok(),
+        _ => panic!("Only P and A can be updated with a CSC matrix"),
+    });
+    if !updated {
+        return false;
+    }
+    _sync_problem(&mut solver.problem, &method, |target| {
+        let ok = target.len() == mat.nzval.len();
+        if ok {
+            target.copy_from_slice(&mat.nzval);
+        }
+        ok
+    });
+    true
+}
 
 // Wrapper function to update solver P or A data (csc based full rewrite form)
+// Returns false if the solver pattern is locked and the new pattern differs.
 #[allow(non_snake_case)]
 unsafe fn _internal_DefaultSolver_update_csc<T: FloatT>(
     solver: *mut c_void,
     mat: *const ClarabelCscMatrix<T>, 
     method: DataUpdateTarget
-) {
+) -> bool {
 
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // convert values to rust CSC types
     let mat = utils::convert_from_C_CscMatrix(mat);
 
     // Use the recovered solver object
-    match method {
-        DataUpdateTarget::P => solver.update_P(&mat).unwrap(),
-        DataUpdateTarget::A => solver.update_A(&mat).unwrap(),
-        _ => panic!("Only P and A can be updated with a CSC matrix"),
-    }
+    let updated = _apply_csc_update(solver, &mat, method);
 
     // Ensure Rust does not free the memory of arrays managed by C
     forget(mat);
+    updated
+}
+
+// As above, for a CSC matrix with 32-bit indices
+#[allow(non_snake_case)]
+unsafe fn _internal_DefaultSolver_update_csc_i32<T: FloatT>(
+    solver: *mut c_void,
+    mat: *const ClarabelCscMatrix_i32<T>, 
+    method: DataUpdateTarget
+) -> bool {
+
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    // An unchanged pattern is a values-only update, with no need to widen the indices
+    if let Some(raw) = mat.as_ref() {
+        let (colptr, rowval) = csc_indices(raw.n, raw.colptr, raw.rowval);
+        if _same_stored_pattern(solver, (raw.m, raw.n, colptr, rowval), &method) {
+            let nzval = match raw.nzval.is_null() {
+                true => &[][..],
+                false => slice::from_raw_parts(raw.nzval, rowval.len()),
+            };
+            _apply_values_update(solver, nzval, method);
+            return true;
+        }
+    }
+
+    // convert values to rust CSC types, widening the indices
+    let mat = utils::convert_from_C_CscMatrix_i32(mat);
+
+    // Use the recovered solver object
+    let updated = _apply_csc_update(solver, &mat, method);
+
+    // Ensure Rust does not free the values array managed by C
+    utils::release_C_CscMatrix_i32(mat);
+    updated
 }
 
 // Wrapper function to update solver P or Adata (array based full rewrite form)
@@ -51,18 +230,13 @@ unsafe fn _internal_DefaultSolver_update<T: FloatT>(
 ) {
 
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // convert values to a vector
     let nzval = Vec::from_raw_parts(nzval as *mut T, nnz, nnz);
 
     // Use the recovered solver object
-    match method {
-        DataUpdateTarget::P => solver.update_P(&nzval).unwrap(),
-        DataUpdateTarget::A => solver.update_A(&nzval).unwrap(),
-        DataUpdateTarget::q => solver.update_q(&nzval).unwrap(),
-        DataUpdateTarget::b => solver.update_b(&nzval).unwrap(),
-    }
+    _apply_values_update(solver, &nzval, method);
 
     // Ensure Rust does not free the memory of arrays managed by C
     forget(nzval);
@@ -78,25 +252,168 @@ unsafe fn _internal_DefaultSolver_update_partial<T: FloatT>(
     method: DataUpdateTarget
 ) {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // convert values to a vector
     let index  = Vec::from_raw_parts(index as *mut usize, nvals, nvals);
     let values = Vec::from_raw_parts(values as *mut T, nvals, nvals);
 
     // Use the recovered solver object
-    match method {
-        DataUpdateTarget::P => solver.update_P(&zip(&index,&values)).unwrap(),
-        DataUpdateTarget::A => solver.update_A(&zip(&index,&values)).unwrap(),
-        DataUpdateTarget::q => solver.update_q(&zip(&index,&values)).unwrap(),
-        DataUpdateTarget::b => solver.update_b(&zip(&index,&values)).unwrap(),
-    }
+    solver.timed_update(|solver| _update_partial(solver, &index, &values, &method));
+    _sync_problem(&mut solver.problem, &method, |target| {
+        let ok = index.iter().all(|&i| i < target.len());
+        if ok {
+            for (&i, &v) in zip(&index, &values) {
+                target[i] = v;
+            }
+        }
+        ok
+    });
 
     // Ensure Rust does not free the memory of arrays managed by C
     forget(index);
     forget(values);
 }
 
+// Sorted partial updates touching at least 1/DENSE_UPDATE_FRACTION of the entries
+// are passed to the solver as a full rewrite from the solver's copy of the data
+const DENSE_UPDATE_FRACTION: usize = 4;
+
+// Wrapper function to update solver data (array based partial rewrite form, with
+// strictly increasing indices).  The indices are validated in a single pass and
+// scattered into the solver's copy of the data without further checks.  Returns
+// false if the indices are not strictly increasing or out of range.
+#[allow(non_snake_case)]
+unsafe fn _internal_DefaultSolver_update_sorted<T: FloatT, I: PatternIndex>(
+    solver: *mut c_void,
+    index: *const I,
+    values: *const T,
+    nvals: usize,
+    method: DataUpdateTarget
+) -> bool {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    if nvals == 0 {
+        return true;
+    }
+    let index = slice::from_raw_parts(index, nvals);
+    let values = slice::from_raw_parts(values, nvals);
+
+    if !index.windows(2).all(|w| w[0].widen() < w[1].widen()) {
+        return false;
+    }
+    let last = index[nvals - 1].widen();
+
+    let Some(mut problem) = solver.problem.take() else {
+        // no copy of the data to scatter into, bound the indices by the solver's own data
+        if last >= _solver_len(&solver.solver, &method) as u64 {
+            return false;
+        }
+        _update_partial_indices(solver, index, values, &method);
+        return true;
+    };
+
+    let target = _problem_values(&mut problem, &method);
+    if last >= target.len() as u64 {
+        solver.problem = Some(problem);
+        return false;
+    }
+    for (&i, &v) in zip(index, values) {
+        *target.get_unchecked_mut(i.widen() as usize) = v;
+    }
+
+    if nvals * DENSE_UPDATE_FRACTION >= target.len() {
+        solver.timed_update(|solver| _update_values(solver, target, &method));
+    } else {
+        _update_partial_indices(solver, index, values, &method);
+    }
+    solver.problem = Some(problem);
+    true
+}
+
+// Partial update with validated indices, passed on as they are when already usize
+// and widened into a temporary copy otherwise
+fn _update_partial_indices<T: FloatT, I: PatternIndex>(
+    solver: &mut DefaultSolverHandle<T>,
+    index: &[I],
+    values: &[T],
+    method: &DataUpdateTarget
+) {
+    match I::as_native(index) {
+        Some(index) => solver.timed_update(|solver| _update_partial(solver, index, values, method)),
+        None => {
+            let index: Vec<usize> = index.iter().map(|&i| i.widen() as usize).collect();
+            solver.timed_update(|solver| _update_partial(solver, &index, values, method))
+        }
+    }
+}
+
+// Wrapper function to update any of P, A, q and b in one call (array based full
+// rewrite form).  Null arrays are left unchanged.
+#[allow(non_snake_case)]
+unsafe fn _internal_DefaultSolver_update_data<T: FloatT>(
+    solver: *mut c_void,
+    Pnzval: *const T,
+    nnzP: usize,
+    q: *const T,
+    n: usize,
+    Anzval: *const T,
+    nnzA: usize,
+    b: *const T,
+    m: usize,
+) {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    let values = |ptr: *const T, len: usize| match ptr.is_null() {
+        true => None,
+        false => Some(slice::from_raw_parts(ptr, len)),
+    };
+    let fields = [
+        (DataUpdateTarget::P, values(Pnzval, nnzP)),
+        (DataUpdateTarget::q, values(q, n)),
+        (DataUpdateTarget::A, values(Anzval, nnzA)),
+        (DataUpdateTarget::b, values(b, m)),
+    ];
+
+    // a single timed update for all fields
+    solver.timed_update(|solver| {
+        for (method, values) in &fields {
+            if let Some(values) = values {
+                _update_values(solver, values, method);
+            }
+        }
+    });
+    for (method, values) in &fields {
+        if let Some(values) = values {
+            _sync_values(&mut solver.problem, values, method);
+        }
+    }
+}
+
+macro_rules! _make_clarabel_DefaultSolver_update_data {
+    ($TYPE:expr)=> {
+
+        paste!{
+            #[no_mangle]
+            #[allow(non_snake_case)]
+            pub unsafe extern "C" fn [<clarabel_DefaultSolver_ $TYPE _update_data>](
+                solver: *mut [<ClarabelDefaultSolver _$TYPE>],
+                Pnzval: *const $TYPE,
+                nnzP: usize,
+                q: *const $TYPE,
+                n: usize,
+                Anzval: *const $TYPE,
+                nnzA: usize,
+                b: *const $TYPE,
+                m: usize,
+            ) {
+                _internal_DefaultSolver_update_data::<$TYPE>(solver,Pnzval,nnzP,q,n,Anzval,nnzA,b,m);
+            }
+        }
+    }
+}
 
 macro_rules! _make_clarabel_DefaultSolver_update_csc {
     ($TYPE:expr,$FIELD:expr)=> {
@@ -107,8 +424,18 @@ macro_rules! _make_clarabel_DefaultSolver_update_csc {
             pub unsafe extern "C" fn [<clarabel_DefaultSolver_ $TYPE _update_ $FIELD _csc>](
                 solver: *mut [<ClarabelDefaultSolver _$TYPE>],
                 P: *const ClarabelCscMatrix<$TYPE>,
-            ) {
-                _internal_DefaultSolver_update_csc::<$TYPE>(solver,P,DataUpdateTarget::$FIELD);
+            ) -> bool {
+                _internal_DefaultSolver_update_csc::<$TYPE>(solver,P,DataUpdateTarget::$FIELD)
+            }
+
+
+            #[no_mangle]
+            #[allow(non_snake_case)]
+            pub unsafe extern "C" fn [<clarabel_DefaultSolver_ $TYPE _update_ $FIELD _csc_i32>](
+                solver: *mut [<ClarabelDefaultSolver _$TYPE>],
+                P: *const ClarabelCscMatrix_i32<$TYPE>,
+            ) -> bool {
+                _internal_DefaultSolver_update_csc_i32::<$TYPE>(solver,P,DataUpdateTarget::$FIELD)
             }
         }
     }
@@ -139,6 +466,30 @@ macro_rules! _make_clarabel_DefaultSolver_update {
             ) {
                 _internal_DefaultSolver_update_partial::<$TYPE>(solver,index,values,nvals,DataUpdateTarget::$FIELD);
             }
+
+
+            #[no_mangle]
+            #[allow(non_snake_case)]
+            pub unsafe extern "C" fn [<clarabel_DefaultSolver_ $TYPE _update_ $FIELD _sorted>](
+                solver: *mut [<ClarabelDefaultSolver _$TYPE>],
+                index: *const usize,
+                values: *const $TYPE,
+                nvals: usize,
+            ) -> bool {
+                _internal_DefaultSolver_update_sorted::<$TYPE,usize>(solver,index,values,nvals,DataUpdateTarget::$FIELD)
+            }
+
+
+            #[no_mangle]
+            #[allow(non_snake_case)]
+            pub unsafe extern "C" fn [<clarabel_DefaultSolver_ $TYPE _update_ $FIELD _sorted_i32>](
+                solver: *mut [<ClarabelDefaultSolver _$TYPE>],
+                index: *const i32,
+                values: *const $TYPE,
+                nvals: usize,
+            ) -> bool {
+                _internal_DefaultSolver_update_sorted::<$TYPE,i32>(solver,index,values,nvals,DataUpdateTarget::$FIELD)
+            }
         }
     }
 }
@@ -157,3 +508,5 @@ _make_clarabel_DefaultSolver_update!(f32,q);
 _make_clarabel_DefaultSolver_update!(f64,b);
 _make_clarabel_DefaultSolver_update!(f32,b);
 
+_make_clarabel_DefaultSolver_update_data!(f64);
+_make_clarabel_DefaultSolver_update_data!(f32);
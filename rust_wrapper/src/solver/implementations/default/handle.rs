@@ -0,0 +1,312 @@
+#![allow(non_snake_case)]
+
+use super::callbacks::{CallbackFcnFFI, IterationObserver};
+use super::cancel::ClarabelCancelToken;
+use super::kkt::KktFactors;
+use super::timings::ClarabelDefaultTimings;
+use crate::structure::{same_indices, PatternIndex};
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::solver::{self as lib, IPSolver};
+use std::ffi::c_void;
+use std::ops::{Deref, DerefMut};
+use std::sync::atomic::AtomicUsize;
+use std::sync::Arc;
+use std::time::Instant;
+
+/// The object behind the opaque solver pointers handed out to C.
+///
+/// Holds the Clarabel.rs solver together with state that is owned by the
+/// wrapper itself.  Derefs to the underlying solver, so it can be used
+/// wherever a `lib::DefaultSolver<T>` is expected.
+pub(crate) struct DefaultSolverHandle<T: FloatT> {
+    pub solver: lib::DefaultSolver<T>,
+    pub timings: ClarabelDefaultTimings,
+
+    // check CSC updates against the pattern of the problem data copy, when kept,
+    // before the solver sees them
+    pub pattern_locked: bool,
+
+    // copy of the current problem data, kept in step with data updates, for
+    // cloning, binary snapshots and KKT solves.  Only kept when asked for at
+    // construction, and for solvers built by a pool or loaded from a snapshot.
+    pub problem: Option<ProblemData<T>>,
+
+    // factors of the KKT system at the last solution, built on the first KKT
+    // solve and dropped by the next solve or data update.  See kkt.rs.
+    pub kkt: Option<KktFactors<T>>,
+
+    // set by data updates and cleared by the next solve, so that the KKT
+    // system is not built from a solution of different data
+    pub data_changed: bool,
+
+    // Clarabel.rs has a single per-iteration callback slot, shared by the C
+    // termination callback and the iteration observer.  See callbacks.rs.
+    pub termination: Option<(CallbackFcnFFI<T>, *mut c_void)>,
+    pub observer: Option<Arc<IterationObserver<T>>>,
+    pub cancel: Option<Arc<ClarabelCancelToken>>,
+
+    // bytes written so far when printing into a caller-provided fixed buffer
+    pub print_written: Option<Arc<AtomicUsize>>,
+
+    // the solver pool this solver was handed out by, and its structure key.  See pool.rs.
+    pub pooled: Option<(usize, u64)>,
+}
+
+/// The problem data a solver was built from
+#[derive(Clone)]
+pub(crate) struct ProblemData<T: FloatT> {
+    pub P: StoredCsc<T>,
+    pub q: Vec<T>,
+    pub A: StoredCsc<T>,
+    pub b: Vec<T>,
+    pub cones: Vec<lib::SupportedConeT<T>>,
+}
+
+impl<T: FloatT> ProblemData<T> {
+    pub fn new(
+        P: &CscMatrix<T>,
+        q: &[T],
+        A: &CscMatrix<T>,
+        b: &[T],
+        cones: Vec<lib::SupportedConeT<T>>,
+    ) -> Self {
+        Self {
+            P: StoredCsc::from(P),
+            q: q.to_vec(),
+            A: StoredCsc::from(A),
+            b: b.to_vec(),
+            cones,
+        }
+    }
+
+    /// As new, taking ownership of data that is no longer needed elsewhere
+    pub fn from_parts(
+        P: CscMatrix<T>,
+        q: Vec<T>,
+        A: CscMatrix<T>,
+        b: Vec<T>,
+        cones: Vec<lib::SupportedConeT<T>>,
+    ) -> Self {
+        Self {
+            P: StoredCsc::from_owned(P),
+            q,
+            A: StoredCsc::from_owned(A),
+            b,
+            cones,
+        }
+    }
+}
+
+/// Index array of a stored matrix.  Copies are kept at 32 bits whenever the
+/// values fit; arrays handed over by value are kept as they are.
+#[derive(Clone)]
+pub(crate) enum StoredIndices {
+    U32(Vec<u32>),
+    Usize(Vec<usize>),
+}
+
+impl StoredIndices {
+    fn from(idx: &[usize]) -> Self {
+        match idx.iter().all(|&i| i <= u32::MAX as usize) {
+            true => StoredIndices::U32(idx.iter().map(|&i| i as u32).collect()),
+            false => StoredIndices::Usize(idx.to_vec()),
+        }
+    }
+
+    fn from_owned(idx: Vec<usize>) -> Self {
+        StoredIndices::Usize(idx)
+    }
+
+    fn to_usize(&self) -> Vec<usize> {
+        match self {
+            StoredIndices::U32(idx) => idx.iter().map(|&i| i as usize).collect(),
+            StoredIndices::Usize(idx) => idx.clone(),
+        }
+    }
+
+    fn matches<I: PatternIndex>(&self, idx: &[I]) -> bool {
+        match self {
+            StoredIndices::U32(stored) => same_indices(stored, idx),
+            StoredIndices::Usize(stored) => same_indices(stored, idx),
+        }
+    }
+}
+
+/// Compact copy of a CSC matrix held by the wrapper
+#[derive(Clone)]
+pub(crate) struct StoredCsc<T: FloatT> {
+    pub m: usize,
+    pub n: usize,
+    pub colptr: StoredIndices,
+    pub rowval: StoredIndices,
+    pub nzval: Vec<T>,
+}
+
+impl<T: FloatT> StoredCsc<T> {
+    fn from(M: &CscMatrix<T>) -> Self {
+        Self {
+            m: M.m,
+            n: M.n,
+            colptr: StoredIndices::from(&M.colptr),
+            rowval: StoredIndices::from(&M.rowval),
+            nzval: M.nzval.clone(),
+        }
+    }
+
+    fn from_owned(M: CscMatrix<T>) -> Self {
+        Self {
+            m: M.m,
+            n: M.n,
+            colptr: StoredIndices::from_owned(M.colptr),
+            rowval: StoredIndices::from_owned(M.rowval),
+            nzval: M.nzval,
+        }
+    }
+
+    /// True if the matrix with these dimensions and index arrays has the same pattern
+    pub fn same_pattern<I: PatternIndex>(&self, m: usize, n: usize, colptr: &[I], rowval: &[I]) -> bool {
+        self.m == m && self.n == n && self.colptr.matches(colptr) && self.rowval.matches(rowval)
+    }
+
+    /// Expand back into the form taken by Clarabel.rs
+    pub fn to_csc(&self) -> CscMatrix<T> {
+        CscMatrix {
+            m: self.m,
+            n: self.n,
+            colptr: self.colptr.to_usize(),
+            rowval: self.rowval.to_usize(),
+            nzval: self.nzval.clone(),
+        }
+    }
+}
+
+impl<T: FloatT> DefaultSolverHandle<T> {
+    /// Wrap a solver just built by Clarabel.rs
+    pub fn new(solver: lib::DefaultSolver<T>, setup_time: f64) -> Self {
+        let mut handle = Self {
+            solver,
+            timings: ClarabelDefaultTimings {
+                setup_time,
+                ..Default::default()
+            },
+            pattern_locked: false,
+            problem: None,
+            kkt: None,
+            data_changed: false,
+            termination: None,
+            observer: None,
+            cancel: None,
+            print_written: None,
+            pooled: None,
+        };
+        // building the solver ran the symbolic analysis of its KKT system
+        handle.timings.symbolic_count += 1;
+        handle
+    }
+
+    /// Keep a copy of the problem data the solver was built from
+    pub fn with_problem(mut self, problem: ProblemData<T>) -> Self {
+        self.problem = Some(problem);
+        self
+    }
+
+    /// Build an independent solver for the current problem data and settings
+    ///
+    /// The pattern lock is carried over, timings and callbacks are not, except
+    /// that the symbolic analyses of this solver are added to the clone's own.
+    pub fn try_clone(&self) -> Option<Self> {
+        let problem = self.problem.as_ref()?;
+
+        let P = problem.P.to_csc();
+        let A = problem.A.to_csc();
+
+        let start = Instant::now();
+        let solver = lib::DefaultSolver::<T>::new(
+            &P,
+            &problem.q,
+            &A,
+            &problem.b,
+            &problem.cones,
+            self.solver.settings.clone(),
+        )
+        .ok()?;
+        let setup_time = start.elapsed().as_secs_f64();
+
+        let mut clone = Self::new(solver, setup_time);
+        clone.timings.symbolic_count += self.timings.symbolic_count;
+        clone.problem = Some(problem.clone());
+        clone.pattern_locked = self.pattern_locked;
+        Some(clone)
+    }
+
+    /// Check a CSC update against the pattern of the problem data copy when the
+    /// pattern is locked.
+    ///
+    /// Solvers that keep no copy leave the check to Clarabel.rs, which rejects a
+    /// CSC update whose pattern differs from its own.
+    pub fn check_pattern(&self, M: &CscMatrix<T>, is_P: bool) -> bool {
+        match (self.pattern_locked, &self.problem) {
+            (true, Some(problem)) => {
+                let stored = if is_P { &problem.P } else { &problem.A };
+                stored.same_pattern(M.m, M.n, &M.colptr, &M.rowval)
+            }
+            _ => true,
+        }
+    }
+
+    /// Box the handle and release it as an opaque pointer
+    pub fn into_raw(self) -> *mut c_void {
+        Box::into_raw(Box::new(self)) as *mut c_void
+    }
+
+    /// Recover the handle from an opaque pointer
+    ///
+    /// # Safety
+    /// `ptr` must have been produced by `into_raw` and not yet freed.
+    pub unsafe fn from_raw<'a>(ptr: *mut c_void) -> &'a mut Self {
+        &mut *(ptr as *mut Self)
+    }
+
+    /// Solve, recording the wall time and iteration count
+    pub fn solve(&mut self) {
+        let start = Instant::now();
+        if let Some(observer) = &self.observer {
+            observer.start_solve(start);
+        }
+        self.kkt = None;
+        self.data_changed = false;
+        self.solver.solve();
+        let elapsed = start.elapsed().as_secs_f64();
+
+        let timings = &mut self.timings;
+        timings.last_solve_time = elapsed;
+        timings.solve_time += elapsed;
+        timings.solve_count += 1;
+        timings.iterations += self.solver.info.iterations;
+    }
+
+    /// Apply a data update to the solver, recording the wall time
+    pub fn timed_update<R>(&mut self, update: impl FnOnce(&mut lib::DefaultSolver<T>) -> R) -> R {
+        self.kkt = None;
+        self.data_changed = true;
+        let start = Instant::now();
+        let result = update(&mut self.solver);
+        self.timings.update_time += start.elapsed().as_secs_f64();
+        self.timings.update_count += 1;
+        result
+    }
+}
+
+impl<T: FloatT> Deref for DefaultSolverHandle<T> {
+    type Target = lib::DefaultSolver<T>;
+
+    fn deref(&self) -> &Self::Target {
+        &self.solver
+    }
+}
+
+impl<T: FloatT> DerefMut for DefaultSolverHandle<T> {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.solver
+    }
+}
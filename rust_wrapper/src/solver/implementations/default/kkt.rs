@@ -0,0 +1,295 @@
+#![allow(non_snake_case)]
+
+use super::handle::DefaultSolverHandle;
+use super::solver::*;
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::qdldl::{QDLDLFactorisation, QDLDLSettings};
+use clarabel::solver as lib;
+use std::cmp::Ordering;
+use std::ffi::c_void;
+use std::slice;
+
+// Diagonal of the scaling block H at the solution, or None for cones other than
+// zero and nonnegative cones, whose scaling block is not diagonal
+fn _scaling_diagonal<T: FloatT>(cones: &[lib::SupportedConeT<T>], s: &[T], z: &[T]) -> Option<Vec<T>> {
+    let mut H = Vec::with_capacity(s.len());
+    for cone in cones {
+        match cone {
+            lib::SupportedConeT::ZeroConeT(dim) => H.extend(std::iter::repeat(T::zero()).take(*dim)),
+            lib::SupportedConeT::NonnegativeConeT(dim) => {
+                let i = H.len();
+                for k in i..i + dim {
+                    H.push(s[k] / z[k].max(T::epsilon()));
+                }
+            }
+            _ => return None,
+        }
+    }
+    Some(H)
+}
+
+// Upper triangle of [P A'; A -H], with every diagonal entry present
+fn _assemble_kkt<T: FloatT>(P: &CscMatrix<T>, A: &CscMatrix<T>, H: &[T]) -> CscMatrix<T> {
+    let (n, m) = (P.n, A.m);
+    let nnz = P.nzval.len() + A.nzval.len() + n + m;
+    let mut colptr = Vec::with_capacity(n + m + 1);
+    let mut rowval = Vec::with_capacity(nnz);
+    let mut nzval = Vec::with_capacity(nnz);
+
+    colptr.push(0);
+    for j in 0..n {
+        let mut diagonal = false;
+        for k in P.colptr[j]..P.colptr[j + 1] {
+            let i = P.rowval[k];
+            if i <= j {
+                rowval.push(i);
+                nzval.push(P.nzval[k]);
+                diagonal |= i == j;
+            }
+        }
+        if !diagonal {
+            rowval.push(j);
+            nzval.push(T::zero());
+        }
+        colptr.push(rowval.len());
+    }
+
+    // the columns of A' are the rows of A
+    let mut rowptr = vec![0; m + 1];
+    for &i in &A.rowval {
+        rowptr[i + 1] += 1;
+    }
+    for i in 0..m {
+        rowptr[i + 1] += rowptr[i];
+    }
+    let start = rowval.len();
+    rowval.resize(start + A.nzval.len() + m, 0);
+    nzval.resize(start + A.nzval.len() + m, T::zero());
+    let mut next: Vec<usize> = (0..m).map(|i| start + rowptr[i] + i).collect();
+    for j in 0..n {
+        for k in A.colptr[j]..A.colptr[j + 1] {
+            let i = A.rowval[k];
+            rowval[next[i]] = j;
+            nzval[next[i]] = A.nzval[k];
+            next[i] += 1;
+        }
+    }
+    for i in 0..m {
+        rowval[next[i]] = n + i;
+        nzval[next[i]] = -H[i];
+        colptr.push(next[i] + 1);
+    }
+
+    CscMatrix {
+        m: n + m,
+        n: n + m,
+        colptr,
+        rowval,
+        nzval,
+    }
+}
+
+/// Factorisation of the KKT system at the last solution, with the diagonal H
+pub(crate) struct KktFactors<T: FloatT> {
+    factors: QDLDLFactorisation<T>,
+    H: Vec<T>,
+}
+
+// Factors of the KKT system at the last solution, from the cache on the handle
+// or factored now.  The caller puts them back into solver.kkt once done.  None
+// if the solver holds no problem data, has not solved to optimality, had its
+// data updated since, has other cones or the system cannot be factored.
+fn _take_kkt<T: FloatT>(solver: &mut DefaultSolverHandle<T>) -> Option<KktFactors<T>> {
+    let problem = solver.problem.as_ref()?;
+    if solver.data_changed {
+        return None;
+    }
+    if !matches!(solver.solution.status, lib::SolverStatus::Solved | lib::SolverStatus::AlmostSolved) {
+        return None;
+    }
+    if let Some(kkt) = solver.kkt.take() {
+        return Some(kkt);
+    }
+    let (n, m) = (problem.P.n, problem.A.m);
+
+    let H = _scaling_diagonal(&problem.cones, &solver.solution.s, &solver.solution.z)?;
+    let K = _assemble_kkt(&problem.P.to_csc(), &problem.A.to_csc(), &H);
+
+    let mut settings = QDLDLSettings::<T>::default();
+    settings.Dsigns = Some((0..n + m).map(|k| if k < n { 1 } else { -1 }).collect());
+    let factors = QDLDLFactorisation::new(&K, Some(settings)).ok()?;
+    Some(KktFactors { factors, H })
+}
+
+/// Solve the KKT system [P A'; A -H] [x; z] = rhs of the last solution for
+/// each of nrhs right hand sides in turn, reusing the factors
+unsafe fn _internal_DefaultSolver_solve_kkt<T: FloatT>(solver: *mut c_void, rhs: *mut T, dim: usize, nrhs: usize) -> bool {
+    let solver = DefaultSolverHandle::<T>::from_raw(solver);
+    match &solver.problem {
+        Some(problem) if dim == problem.P.n + problem.A.m => {}
+        _ => return false,
+    }
+    let mut kkt = match _take_kkt(solver) {
+        Some(kkt) => kkt,
+        None => return false,
+    };
+    if dim > 0 && nrhs > 0 {
+        let rhs = slice::from_raw_parts_mut(rhs, dim * nrhs);
+        for column in rhs.chunks_exact_mut(dim) {
+            kkt.factors.solve(column);
+        }
+    }
+    solver.kkt = Some(kkt);
+    true
+}
+
+/// Gradients of a loss with respect to the problem data, given its gradients
+/// dx, dz and ds with respect to the solution
+///
+/// The solution map is differentiated implicitly through the KKT conditions
+/// P x + q + A'z = 0, A x + s = b and s.*z = mu, so the whole backward pass is
+/// one solve with the symmetric KKT system.  Null inputs are taken as zero and
+/// null outputs are skipped.
+unsafe fn _internal_DefaultSolver_backward<T: FloatT>(
+    solver: *mut c_void,
+    dx: *const T,
+    dz: *const T,
+    ds: *const T,
+    dP: *mut T,
+    nnzP: usize,
+    dq: *mut T,
+    n: usize,
+    dA: *mut T,
+    nnzA: usize,
+    db: *mut T,
+    m: usize,
+) -> bool {
+    let solver = DefaultSolverHandle::<T>::from_raw(solver);
+    match &solver.problem {
+        Some(problem)
+            if n == problem.P.n
+                && m == problem.A.m
+                && nnzP == problem.P.nzval.len()
+                && nnzA == problem.A.nzval.len() => {}
+        _ => return false,
+    }
+    let mut kkt = match _take_kkt(solver) {
+        Some(kkt) => kkt,
+        None => return false,
+    };
+    let H = &kkt.H;
+
+    // ds = -H dz, so the loss gradient with respect to [x; z] is [dx; dz - H ds]
+    let mut u = vec![T::zero(); n + m];
+    if !dx.is_null() {
+        u[..n].copy_from_slice(slice::from_raw_parts(dx, n));
+    }
+    if !dz.is_null() {
+        u[n..].copy_from_slice(slice::from_raw_parts(dz, m));
+    }
+    if !ds.is_null() {
+        for (i, &d) in slice::from_raw_parts(ds, m).iter().enumerate() {
+            u[n + i] = u[n + i] - H[i] * d;
+        }
+    }
+    if n + m > 0 {
+        kkt.factors.solve(&mut u);
+    }
+    solver.kkt = Some(kkt);
+    let problem = solver.problem.as_ref().unwrap();
+    let (ux, uz) = u.split_at(n);
+    let (x, z) = (&solver.solution.x, &solver.solution.z);
+
+    // K [dx; dz] = [-dq - dP x - dA'z; db - dA x] and K is symmetric
+    if !dq.is_null() {
+        for (g, &v) in slice::from_raw_parts_mut(dq, n).iter_mut().zip(ux) {
+            *g = -v;
+        }
+    }
+    if !db.is_null() {
+        slice::from_raw_parts_mut(db, m).copy_from_slice(uz);
+    }
+    if !dP.is_null() {
+        // an off-diagonal entry of the upper triangle stands for both P[i,j] and P[j,i],
+        // and entries below the diagonal are not used by the solver
+        let dP = slice::from_raw_parts_mut(dP, nnzP);
+        let P = problem.P.to_csc();
+        for j in 0..n {
+            for k in P.colptr[j]..P.colptr[j + 1] {
+                let i = P.rowval[k];
+                dP[k] = match i.cmp(&j) {
+                    Ordering::Equal => -(ux[i] * x[i]),
+                    Ordering::Less => -(ux[i] * x[j] + ux[j] * x[i]),
+                    Ordering::Greater => T::zero(),
+                };
+            }
+        }
+    }
+    if !dA.is_null() {
+        let dA = slice::from_raw_parts_mut(dA, nnzA);
+        let A = problem.A.to_csc();
+        for j in 0..n {
+            for k in A.colptr[j]..A.colptr[j + 1] {
+                let i = A.rowval[k];
+                dA[k] = -(ux[j] * z[i] + uz[i] * x[j]);
+            }
+        }
+    }
+    true
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_solve_kkt(
+    solver: *mut ClarabelDefaultSolver_f64,
+    rhs: *mut f64,
+    dim: usize,
+    nrhs: usize,
+) -> bool {
+    _internal_DefaultSolver_solve_kkt::<f64>(solver, rhs, dim, nrhs)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_solve_kkt(
+    solver: *mut ClarabelDefaultSolver_f32,
+    rhs: *mut f32,
+    dim: usize,
+    nrhs: usize,
+) -> bool {
+    _internal_DefaultSolver_solve_kkt::<f32>(solver, rhs, dim, nrhs)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_backward(
+    solver: *mut ClarabelDefaultSolver_f64,
+    dx: *const f64,
+    dz: *const f64,
+    ds: *const f64,
+    dP: *mut f64,
+    nnzP: usize,
+    dq: *mut f64,
+    n: usize,
+    dA: *mut f64,
+    nnzA: usize,
+    db: *mut f64,
+    m: usize,
+) -> bool {
+    _internal_DefaultSolver_backward::<f64>(solver, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_backward(
+    solver: *mut ClarabelDefaultSolver_f32,
+    dx: *const f32,
+    dz: *const f32,
+    ds: *const f32,
+    dP: *mut f32,
+    nnzP: usize,
+    dq: *mut f32,
+    n: usize,
+    dA: *mut f32,
+    nnzA: usize,
+    db: *mut f32,
+    m: usize,
+) -> bool {
+    _internal_DefaultSolver_backward::<f32>(solver, dx, dz, ds, dP, nnzP, dq, n, dA, nnzA, db, m)
+}
@@ -1,6 +1,14 @@
+pub mod async_solve;
+pub mod batch;
+pub mod cancel;
 pub mod callbacks;
 pub mod data_updating;
+pub mod handle;
 pub mod info;
+pub mod kkt;
+pub mod pool;
 pub mod settings;
 pub mod solution;
+pub mod snapshot;
 pub mod solver;
+pub mod timings;
@@ -0,0 +1,419 @@
+#![allow(non_snake_case)]
+#![allow(non_camel_case_types)]
+
+use super::callbacks::_install_callbacks;
+use super::handle::DefaultSolverHandle;
+use super::settings::{ClarabelDefaultSettings, ClarabelDefaultSettings_f32, ClarabelDefaultSettings_f64};
+use super::solver::*;
+use super::timings::ClarabelDefaultTimings;
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
+use crate::core::cones::ClarabelSupportedConeT;
+use crate::structure::StructureHasher;
+use crate::utils;
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::io::ConfigurablePrintTarget;
+use clarabel::solver as lib;
+use std::collections::HashMap;
+use std::ffi::c_void;
+use std::mem::forget;
+use std::slice;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::time::Instant;
+
+pub type ClarabelSolverPool_f64 = c_void;
+pub type ClarabelSolverPool_f32 = c_void;
+
+/// Solvers released for reuse, grouped by problem structure
+///
+/// A solver taken from the pool keeps its KKT, factorisation, cone and residual
+/// workspace and is rebound to new numeric data through the data update path.
+/// All solvers in a pool share the settings the pool was created with.
+struct SolverPool<T: FloatT> {
+    // distinct for every pool created, unlike its address, which a later pool may reuse
+    id: usize,
+    settings: lib::DefaultSettings<T>,
+    // maximum number of idle solvers kept, 0 for no limit
+    max_idle: usize,
+    n_idle: usize,
+    idle: HashMap<u64, Vec<*mut c_void>>,
+}
+
+static NEXT_POOL_ID: AtomicUsize = AtomicUsize::new(1);
+
+impl<T: FloatT> Drop for SolverPool<T> {
+    fn drop(&mut self) {
+        for solver in self.idle.values().flatten() {
+            drop(unsafe { Box::from_raw(*solver as *mut DefaultSolverHandle<T>) });
+        }
+    }
+}
+
+/// Fingerprint of the problem structure, as returned by clarabel_structure_hash
+fn _structure_key<T: FloatT>(P: &CscMatrix<T>, A: &CscMatrix<T>, cones: &[ClarabelSupportedConeT<T>]) -> u64 {
+    let mut hasher = StructureHasher::new();
+    hasher.write_pattern(P.m, P.n, &P.colptr, &P.rowval);
+    hasher.write_pattern(A.m, A.n, &A.colptr, &A.rowval);
+    hasher.write_cones(cones);
+    hasher.finish()
+}
+
+/// Compare a cone from C with one a solver was built with, without converting it
+fn _cone_matches<T: FloatT>(cone: &ClarabelSupportedConeT<T>, built: &lib::SupportedConeT<T>) -> bool {
+    match (cone, built) {
+        (ClarabelSupportedConeT::ZeroConeT(a), lib::SupportedConeT::ZeroConeT(b))
+        | (ClarabelSupportedConeT::NonnegativeConeT(a), lib::SupportedConeT::NonnegativeConeT(b))
+        | (ClarabelSupportedConeT::SecondOrderConeT(a), lib::SupportedConeT::SecondOrderConeT(b)) => a == b,
+        (ClarabelSupportedConeT::ExponentialConeT, lib::SupportedConeT::ExponentialConeT()) => true,
+        (ClarabelSupportedConeT::PowerConeT(a), lib::SupportedConeT::PowerConeT(b)) => a == b,
+        (ClarabelSupportedConeT::GenPowerConeT(alpha, dim1, dim2), lib::SupportedConeT::GenPowerConeT(b, bdim2)) => {
+            dim2 == bdim2 && unsafe { slice::from_raw_parts(*alpha, *dim1) } == &b[..]
+        }
+        #[cfg(feature = "sdp")]
+        (ClarabelSupportedConeT::PSDTriangleConeT(a), lib::SupportedConeT::PSDTriangleConeT(b)) => a == b,
+        _ => false,
+    }
+}
+
+/// Take an idle solver built for exactly this structure out of the pool
+fn _take_matching<T: FloatT>(
+    pool: &mut SolverPool<T>,
+    key: u64,
+    P: &CscMatrix<T>,
+    A: &CscMatrix<T>,
+    cones: &[ClarabelSupportedConeT<T>],
+) -> Option<*mut c_void> {
+    let bucket = pool.idle.get_mut(&key)?;
+    let k = bucket.iter().position(|&solver| {
+        let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+        solver.problem.as_ref().is_some_and(|problem| {
+            problem.P.same_pattern(P.m, P.n, &P.colptr, &P.rowval)
+                && problem.A.same_pattern(A.m, A.n, &A.colptr, &A.rowval)
+                && problem.cones.len() == cones.len()
+                && cones.iter().zip(&problem.cones).all(|(c, b)| _cone_matches(c, b))
+        })
+    })?;
+    pool.n_idle -= 1;
+    Some(bucket.swap_remove(k))
+}
+
+/// Load new numeric data into a recycled solver through the data update path.
+/// Returns false if the data does not fit the solver or an update is rejected,
+/// which may leave the solver partially updated.
+fn _rebind<T: FloatT>(solver: &mut DefaultSolverHandle<T>, P: &CscMatrix<T>, q: &[T], A: &CscMatrix<T>, b: &[T]) -> bool {
+    let start = Instant::now();
+    solver.kkt = None;
+    solver.data_changed = true;
+
+    // pooled solvers always keep their problem data
+    let Some(problem) = solver.problem.as_mut() else {
+        return false;
+    };
+    if P.nzval.len() != problem.P.nzval.len()
+        || A.nzval.len() != problem.A.nzval.len()
+        || q.len() != problem.q.len()
+        || b.len() != problem.b.len()
+    {
+        return false;
+    }
+    let updated = solver.solver.update_P(&P.nzval[..]).is_ok()
+        && solver.solver.update_A(&A.nzval[..]).is_ok()
+        && solver.solver.update_q(q).is_ok()
+        && solver.solver.update_b(b).is_ok();
+    if !updated {
+        return false;
+    }
+
+    // keep the copy of the problem data in step, reusing its storage
+    problem.P.nzval.copy_from_slice(&P.nzval);
+    problem.A.nzval.copy_from_slice(&A.nzval);
+    problem.q.copy_from_slice(q);
+    problem.b.copy_from_slice(b);
+
+    // A recycled solver reports the rebind as its setup, and keeps the symbolic
+    // analysis it was built with
+    solver.timings = ClarabelDefaultTimings {
+        setup_time: start.elapsed().as_secs_f64(),
+        symbolic_count: solver.timings.symbolic_count,
+        ..Default::default()
+    };
+    true
+}
+
+// Hands out a solver for the given problem, recycling an idle one with the same
+// structure when available and building a new one otherwise.  The matrices have
+// already been recovered from C.
+unsafe fn _internal_SolverPool_acquire_with<T: FloatT>(
+    pool: *mut c_void,
+    P: &CscMatrix<T>,
+    q: *const T,
+    A: &CscMatrix<T>,
+    b: *const T,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+) -> *mut c_void {
+    let pool = &mut *(pool as *mut SolverPool<T>);
+
+    let c_cones = match cones.is_null() {
+        true => &[][..],
+        false => slice::from_raw_parts(cones, n_cones),
+    };
+    let key = _structure_key(P, A, c_cones);
+
+    let solver = match _take_matching(pool, key, P, A, c_cones) {
+        Some(solver) => {
+            let q = match q.is_null() {
+                true => &[][..],
+                false => slice::from_raw_parts(q, P.n),
+            };
+            let b = match b.is_null() {
+                true => &[][..],
+                false => slice::from_raw_parts(b, A.m),
+            };
+            if !_rebind(DefaultSolverHandle::<T>::from_raw(solver), P, q, A, b) {
+                _internal_DefaultSolver_free::<T>(solver);
+                return std::ptr::null_mut();
+            }
+            solver
+        }
+        None => _internal_DefaultSolver_build(P, q, A, b, n_cones, cones, pool.settings.clone(), true),
+    };
+
+    if !solver.is_null() {
+        DefaultSolverHandle::<T>::from_raw(solver).pooled = Some((pool.id, key));
+    }
+    solver
+}
+
+unsafe fn _internal_SolverPool_acquire<T: FloatT>(
+    pool: *mut c_void,
+    P: *const ClarabelCscMatrix<T>,
+    q: *const T,
+    A: *const ClarabelCscMatrix<T>,
+    b: *const T,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+) -> *mut c_void {
+    // Check null pointers
+    debug_assert!(!pool.is_null(), "Pointer pool must not be null");
+    if pool.is_null() || P.is_null() || q.is_null() || A.is_null() {
+        return std::ptr::null_mut();
+    }
+    // b may only be omitted when A has no rows, and P and A must agree on n
+    if (b.is_null() && (*A).m > 0) || (*P).m != (*P).n || (*P).n != (*A).n {
+        return std::ptr::null_mut();
+    }
+
+    // Recover the matrices from C structs
+    let P = utils::convert_from_C_CscMatrix(P);
+    let A = utils::convert_from_C_CscMatrix(A);
+
+    let solver = _internal_SolverPool_acquire_with(pool, &P, q, &A, b, n_cones, cones);
+
+    // Ensure Rust does not free the memory of arrays managed by C
+    forget(P);
+    forget(A);
+
+    solver
+}
+
+unsafe fn _internal_SolverPool_acquire_i32<T: FloatT>(
+    pool: *mut c_void,
+    P: *const ClarabelCscMatrix_i32<T>,
+    q: *const T,
+    A: *const ClarabelCscMatrix_i32<T>,
+    b: *const T,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+) -> *mut c_void {
+    // Check null pointers
+    debug_assert!(!pool.is_null(), "Pointer pool must not be null");
+    if pool.is_null() || P.is_null() || q.is_null() || A.is_null() {
+        return std::ptr::null_mut();
+    }
+    // b may only be omitted when A has no rows, and P and A must agree on n
+    if (b.is_null() && (*A).m > 0) || (*P).m != (*P).n || (*P).n != (*A).n {
+        return std::ptr::null_mut();
+    }
+
+    // Recover the matrices from C structs, widening the indices
+    let P = utils::convert_from_C_CscMatrix_i32(P);
+    let A = utils::convert_from_C_CscMatrix_i32(A);
+
+    let solver = _internal_SolverPool_acquire_with(pool, &P, q, &A, b, n_cones, cones);
+
+    // Free the widened indices, but leave the values to C
+    utils::release_C_CscMatrix_i32(P);
+    utils::release_C_CscMatrix_i32(A);
+
+    solver
+}
+
+// Returns a solver to the pool for reuse.  Solvers that were not handed out by
+// this pool, cannot take data updates, or do not fit are freed instead.
+unsafe fn _internal_SolverPool_release<T: FloatT>(pool: *mut c_void, solver: *mut c_void) {
+    if pool.is_null() || solver.is_null() {
+        return;
+    }
+    let pool = &mut *(pool as *mut SolverPool<T>);
+    let handle = DefaultSolverHandle::<T>::from_raw(solver);
+
+    let key = match handle.pooled {
+        Some((id, key)) if id == pool.id => key,
+        _ => {
+            _internal_DefaultSolver_free::<T>(solver);
+            return;
+        }
+    };
+    let full = pool.max_idle != 0 && pool.n_idle >= pool.max_idle;
+    if full || handle.problem.is_none() || !handle.solver.is_data_update_allowed() {
+        _internal_DefaultSolver_free::<T>(solver);
+        return;
+    }
+
+    // Drop everything that refers to memory of the previous user
+    handle.termination = None;
+    handle.observer = None;
+    handle.cancel = None;
+    _install_callbacks(handle);
+    if handle.print_written.take().is_some() {
+        handle.print_to_stdout();
+    }
+    handle.pattern_locked = false;
+
+    pool.idle.entry(key).or_default().push(solver);
+    pool.n_idle += 1;
+}
+
+unsafe fn _internal_SolverPool_new<T: FloatT>(
+    settings: *const ClarabelDefaultSettings<T>,
+    max_idle: usize,
+) -> *mut c_void {
+    if settings.is_null() {
+        return std::ptr::null_mut();
+    }
+    let pool = SolverPool::<T> {
+        id: NEXT_POOL_ID.fetch_add(1, Ordering::Relaxed),
+        settings: _settings_from_C(settings),
+        max_idle,
+        n_idle: 0,
+        idle: HashMap::new(),
+    };
+    Box::into_raw(Box::new(pool)) as *mut c_void
+}
+
+unsafe fn _internal_SolverPool_free<T: FloatT>(pool: *mut c_void) {
+    if !pool.is_null() {
+        drop(Box::from_raw(pool as *mut SolverPool<T>));
+    }
+}
+
+unsafe fn _internal_SolverPool_idle_count<T: FloatT>(pool: *mut c_void) -> usize {
+    match (pool as *const SolverPool<T>).as_ref() {
+        Some(pool) => pool.n_idle,
+        None => 0,
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_new(
+    settings: *const ClarabelDefaultSettings_f64,
+    max_idle: usize,
+) -> *mut ClarabelSolverPool_f64 {
+    _internal_SolverPool_new::<f64>(settings, max_idle)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_new(
+    settings: *const ClarabelDefaultSettings_f32,
+    max_idle: usize,
+) -> *mut ClarabelSolverPool_f32 {
+    _internal_SolverPool_new::<f32>(settings, max_idle)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_free(pool: *mut ClarabelSolverPool_f64) {
+    _internal_SolverPool_free::<f64>(pool);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_free(pool: *mut ClarabelSolverPool_f32) {
+    _internal_SolverPool_free::<f32>(pool);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_acquire(
+    pool: *mut ClarabelSolverPool_f64,
+    P: *const ClarabelCscMatrix<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_SolverPool_acquire(pool, P, q, A, b, n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_acquire(
+    pool: *mut ClarabelSolverPool_f32,
+    P: *const ClarabelCscMatrix<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_SolverPool_acquire(pool, P, q, A, b, n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_acquire_i32(
+    pool: *mut ClarabelSolverPool_f64,
+    P: *const ClarabelCscMatrix_i32<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix_i32<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_SolverPool_acquire_i32(pool, P, q, A, b, n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_acquire_i32(
+    pool: *mut ClarabelSolverPool_f32,
+    P: *const ClarabelCscMatrix_i32<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix_i32<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_SolverPool_acquire_i32(pool, P, q, A, b, n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_release(
+    pool: *mut ClarabelSolverPool_f64,
+    solver: *mut ClarabelDefaultSolver_f64,
+) {
+    _internal_SolverPool_release::<f64>(pool, solver);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_release(
+    pool: *mut ClarabelSolverPool_f32,
+    solver: *mut ClarabelDefaultSolver_f32,
+) {
+    _internal_SolverPool_release::<f32>(pool, solver);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f64_idle_count(pool: *mut ClarabelSolverPool_f64) -> usize {
+    _internal_SolverPool_idle_count::<f64>(pool)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_SolverPool_f32_idle_count(pool: *mut ClarabelSolverPool_f32) -> usize {
+    _internal_SolverPool_idle_count::<f32>(pool)
+}
@@ -3,6 +3,8 @@
 #![allow(dead_code)]
 
 use clarabel::algebra::FloatT;
+use clarabel::solver::{self as lib};
+use std::ffi::c_void;
 
 pub type ClarabelDirectSolveMethods = clarabel::solver::ffi::DirectSolveMethodsFFI;
 
@@ -33,3 +35,61 @@ pub extern "C" fn clarabel_DefaultSettings_f64_default() -> ClarabelDefaultSetti
 pub extern "C" fn clarabel_DefaultSettings_f32_default() -> ClarabelDefaultSettings_f32 {
     _internal_DefaultSettings_default::<f32>()
 }
+
+pub type ClarabelDefaultSettingsHandle_f64 = c_void;
+pub type ClarabelDefaultSettingsHandle_f32 = c_void;
+
+/// Convert and validate settings once, for reuse when constructing many solvers
+///
+/// Returns a null pointer if the settings are invalid.
+unsafe fn _internal_DefaultSettings_compile<T: FloatT>(
+    settings: *const ClarabelDefaultSettings<T>,
+) -> *mut c_void {
+    let settings: lib::DefaultSettings<T> = (*settings).clone().into();
+    match settings.validate() {
+        Ok(_) => Box::into_raw(Box::new(settings)) as *mut c_void,
+        Err(e) => {
+            println!("Error compiling DefaultSettings: {:?}", e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// Recover the settings behind a handle created by _internal_DefaultSettings_compile
+pub(crate) unsafe fn settings_from_handle<'a, T: FloatT>(
+    handle: *const c_void,
+) -> &'a lib::DefaultSettings<T> {
+    &*(handle as *const lib::DefaultSettings<T>)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSettings_f64_compile(
+    settings: *const ClarabelDefaultSettings_f64,
+) -> *mut ClarabelDefaultSettingsHandle_f64 {
+    _internal_DefaultSettings_compile::<f64>(settings)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSettings_f32_compile(
+    settings: *const ClarabelDefaultSettings_f32,
+) -> *mut ClarabelDefaultSettingsHandle_f32 {
+    _internal_DefaultSettings_compile::<f32>(settings)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSettings_f64_free_handle(
+    handle: *mut ClarabelDefaultSettingsHandle_f64,
+) {
+    if !handle.is_null() {
+        drop(Box::from_raw(handle as *mut lib::DefaultSettings<f64>));
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSettings_f32_free_handle(
+    handle: *mut ClarabelDefaultSettingsHandle_f32,
+) {
+    if !handle.is_null() {
+        drop(Box::from_raw(handle as *mut lib::DefaultSettings<f32>));
+    }
+}
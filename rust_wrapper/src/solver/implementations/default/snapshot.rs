@@ -0,0 +1,562 @@
+#![allow(non_snake_case)]
+
+//! Binary problem snapshots.
+//!
+//! A snapshot holds the problem data (P, q, A, b, cones) and the settings of a
+//! solver in a compact native-endian layout:
+//!
+//! ```text
+//! header    magic "CLRBSNAP", version: u32, endian marker: u32, float size: u32,
+//!           feature flags: u32 (bit 0 set when built with `sdp`)
+//! settings  each setting in declaration order: numbers as u32, f64 or T, bools
+//!           as a u8 of 0 or 1, and string options as a u32 tag
+//! P, A      m, n, nnz: u64, colptr: [u64; n+1], rowval: [u64; nnz], nzval: [T; nnz]
+//! q, b      len: u64, values: [T; len]
+//! cones     count: u64, then per cone a u32 tag followed by its parameters
+//! ```
+//!
+//! Loading streams the file through a buffered reader and reads each array
+//! straight into the vector that ends up holding it, without any text parsing
+//! or intermediate copy of the whole file.  The matrices are checked to be
+//! valid CSC matrices and are handed to the solver and then moved, indices
+//! included, into its copy of the problem data.  Snapshots are meant for
+//! replaying problems with the same build of the library; the header rejects
+//! files with a different version, endianness, float type or feature set.
+
+use super::handle::{DefaultSolverHandle, ProblemData, StoredCsc, StoredIndices};
+use super::settings::ClarabelDefaultSettings;
+use super::solver::*;
+use crate::executor;
+use clarabel::algebra::{CscMatrix, FloatT};
+use clarabel::solver as lib;
+use std::ffi::{c_char, c_void};
+use std::io::{self, BufReader, BufWriter, Read, Write};
+use std::mem::size_of;
+use std::time::Instant;
+
+const MAGIC: &[u8; 8] = b"CLRBSNAP";
+const VERSION: u32 = 3;
+const ENDIAN_MARKER: u32 = 0x01020304;
+
+// Features that change the layout of the settings, one bit each
+const FEATURE_SDP: u32 = 1;
+const FEATURES: u32 = if cfg!(feature = "sdp") { FEATURE_SDP } else { 0 };
+
+const TAG_ZERO: u32 = 0;
+const TAG_NONNEGATIVE: u32 = 1;
+const TAG_SECOND_ORDER: u32 = 2;
+const TAG_EXPONENTIAL: u32 = 3;
+const TAG_POWER: u32 = 4;
+const TAG_GENPOWER: u32 = 5;
+#[cfg(feature = "sdp")]
+const TAG_PSD_TRIANGLE: u32 = 6;
+
+// Tags of the string options in the settings are their positions in these lists
+const DIRECT_SOLVE_METHODS: [&str; 5] = ["auto", "qdldl", "faer", "mkl", "panua"];
+#[cfg(feature = "sdp")]
+const MERGE_METHODS: [&str; 3] = ["clique_graph", "parent_child", "none"];
+
+// View a slice of plain values as raw bytes
+fn as_bytes<V>(values: &[V]) -> &[u8] {
+    unsafe { std::slice::from_raw_parts(values.as_ptr() as *const u8, std::mem::size_of_val(values)) }
+}
+
+fn as_bytes_mut<V: Copy>(values: &mut [V]) -> &mut [u8] {
+    unsafe { std::slice::from_raw_parts_mut(values.as_mut_ptr() as *mut u8, std::mem::size_of_val(values)) }
+}
+
+struct Writer<W: Write> {
+    out: W,
+}
+
+impl<W: Write> Writer<W> {
+    fn u8(&mut self, v: u8) -> io::Result<()> {
+        self.out.write_all(&[v])
+    }
+
+    fn u32(&mut self, v: u32) -> io::Result<()> {
+        self.out.write_all(&v.to_ne_bytes())
+    }
+
+    fn u64(&mut self, v: usize) -> io::Result<()> {
+        self.out.write_all(&(v as u64).to_ne_bytes())
+    }
+
+    fn f64(&mut self, v: f64) -> io::Result<()> {
+        self.out.write_all(&v.to_ne_bytes())
+    }
+
+    fn bool(&mut self, v: bool) -> io::Result<()> {
+        self.u8(v as u8)
+    }
+
+    fn real<T: FloatT>(&mut self, v: T) -> io::Result<()> {
+        self.values(&[v])
+    }
+
+    fn tag(&mut self, names: &[&str], name: &str) -> io::Result<()> {
+        match names.iter().position(|&n| n == name) {
+            Some(tag) => self.u32(tag as u32),
+            None => Err(io::Error::new(io::ErrorKind::InvalidData, format!("unknown option {}", name))),
+        }
+    }
+
+    fn values<T: FloatT>(&mut self, v: &[T]) -> io::Result<()> {
+        self.out.write_all(as_bytes(v))
+    }
+
+    fn vector<T: FloatT>(&mut self, v: &[T]) -> io::Result<()> {
+        self.u64(v.len())?;
+        self.values(v)
+    }
+
+    fn indices(&mut self, v: &StoredIndices) -> io::Result<()> {
+        match v {
+            StoredIndices::U32(v) => v.iter().try_for_each(|&i| self.u64(i as usize)),
+            StoredIndices::Usize(v) => v.iter().try_for_each(|&i| self.u64(i)),
+        }
+    }
+
+    fn matrix<T: FloatT>(&mut self, M: &StoredCsc<T>) -> io::Result<()> {
+        self.u64(M.m)?;
+        self.u64(M.n)?;
+        self.u64(M.nzval.len())?;
+        self.indices(&M.colptr)?;
+        self.indices(&M.rowval)?;
+        self.values(&M.nzval)
+    }
+
+    fn settings<T: FloatT>(&mut self, s: &lib::DefaultSettings<T>) -> io::Result<()> {
+        self.u32(s.max_iter)?;
+        self.f64(s.time_limit)?;
+        self.bool(s.verbose)?;
+        self.real(s.max_step_fraction)?;
+        self.real(s.tol_gap_abs)?;
+        self.real(s.tol_gap_rel)?;
+        self.real(s.tol_feas)?;
+        self.real(s.tol_infeas_abs)?;
+        self.real(s.tol_infeas_rel)?;
+        self.real(s.tol_ktratio)?;
+        self.real(s.reduced_tol_gap_abs)?;
+        self.real(s.reduced_tol_gap_rel)?;
+        self.real(s.reduced_tol_feas)?;
+        self.real(s.reduced_tol_infeas_abs)?;
+        self.real(s.reduced_tol_infeas_rel)?;
+        self.real(s.reduced_tol_ktratio)?;
+        self.bool(s.equilibrate_enable)?;
+        self.u32(s.equilibrate_max_iter)?;
+        self.real(s.equilibrate_min_scaling)?;
+        self.real(s.equilibrate_max_scaling)?;
+        self.real(s.linesearch_backtrack_step)?;
+        self.real(s.min_switch_step_length)?;
+        self.real(s.min_terminate_step_length)?;
+        self.u32(s.max_threads)?;
+        self.bool(s.direct_kkt_solver)?;
+        self.tag(&DIRECT_SOLVE_METHODS, &s.direct_solve_method)?;
+        self.bool(s.static_regularization_enable)?;
+        self.real(s.static_regularization_constant)?;
+        self.real(s.static_regularization_proportional)?;
+        self.bool(s.dynamic_regularization_enable)?;
+        self.real(s.dynamic_regularization_eps)?;
+        self.real(s.dynamic_regularization_delta)?;
+        self.bool(s.iterative_refinement_enable)?;
+        self.real(s.iterative_refinement_reltol)?;
+        self.real(s.iterative_refinement_abstol)?;
+        self.u32(s.iterative_refinement_max_iter)?;
+        self.real(s.iterative_refinement_stop_ratio)?;
+        self.bool(s.presolve_enable)?;
+        #[cfg(feature = "sdp")]
+        {
+            self.bool(s.chordal_decomposition_enable)?;
+            self.tag(&MERGE_METHODS, &s.chordal_decomposition_merge_method)?;
+            self.bool(s.chordal_decomposition_compact)?;
+            self.bool(s.chordal_decomposition_complete_dual)?;
+        }
+        Ok(())
+    }
+
+    fn cone<T: FloatT>(&mut self, cone: &lib::SupportedConeT<T>) -> io::Result<()> {
+        match cone {
+            lib::SupportedConeT::ZeroConeT(dim) => {
+                self.u32(TAG_ZERO)?;
+                self.u64(*dim)
+            }
+            lib::SupportedConeT::NonnegativeConeT(dim) => {
+                self.u32(TAG_NONNEGATIVE)?;
+                self.u64(*dim)
+            }
+            lib::SupportedConeT::SecondOrderConeT(dim) => {
+                self.u32(TAG_SECOND_ORDER)?;
+                self.u64(*dim)
+            }
+            lib::SupportedConeT::ExponentialConeT() => self.u32(TAG_EXPONENTIAL),
+            lib::SupportedConeT::PowerConeT(alpha) => {
+                self.u32(TAG_POWER)?;
+                self.real(*alpha)
+            }
+            lib::SupportedConeT::GenPowerConeT(alpha, dim2) => {
+                self.u32(TAG_GENPOWER)?;
+                self.vector(alpha)?;
+                self.u64(*dim2)
+            }
+            #[cfg(feature = "sdp")]
+            lib::SupportedConeT::PSDTriangleConeT(dim) => {
+                self.u32(TAG_PSD_TRIANGLE)?;
+                self.u64(*dim)
+            }
+        }
+    }
+}
+
+// Reads a snapshot straight from the file into the arrays of the decoded
+// problem.  `remaining` is the number of bytes left in the file, so that a
+// corrupted length is rejected before anything is allocated for it.
+struct Reader<R: Read> {
+    input: R,
+    remaining: u64,
+}
+
+impl<R: Read> Reader<R> {
+    fn fill(&mut self, buf: &mut [u8]) -> Result<(), String> {
+        if buf.len() as u64 > self.remaining {
+            return Err("unexpected end of snapshot".to_string());
+        }
+        self.input.read_exact(buf).map_err(|e| e.to_string())?;
+        self.remaining -= buf.len() as u64;
+        Ok(())
+    }
+
+    fn take<const N: usize>(&mut self) -> Result<[u8; N], String> {
+        let mut bytes = [0u8; N];
+        self.fill(&mut bytes)?;
+        Ok(bytes)
+    }
+
+    fn u32(&mut self) -> Result<u32, String> {
+        Ok(u32::from_ne_bytes(self.take()?))
+    }
+
+    fn u64(&mut self) -> Result<usize, String> {
+        Ok(u64::from_ne_bytes(self.take()?) as usize)
+    }
+
+    fn f64(&mut self) -> Result<f64, String> {
+        Ok(f64::from_ne_bytes(self.take()?))
+    }
+
+    fn bool(&mut self) -> Result<bool, String> {
+        match self.take::<1>()?[0] {
+            0 => Ok(false),
+            1 => Ok(true),
+            v => Err(format!("invalid boolean {} in snapshot", v)),
+        }
+    }
+
+    fn real<T: FloatT>(&mut self) -> Result<T, String> {
+        let mut v = T::zero();
+        self.fill(as_bytes_mut(std::slice::from_mut(&mut v)))?;
+        Ok(v)
+    }
+
+    fn tag(&mut self, names: &[&str]) -> Result<String, String> {
+        let tag = self.u32()?;
+        match names.get(tag as usize) {
+            Some(name) => Ok(name.to_string()),
+            None => Err(format!("invalid option tag {} in snapshot", tag)),
+        }
+    }
+
+    // Read `len` plain values into a new array, checking first that the file
+    // still holds that many
+    fn array<V: Copy>(&mut self, len: usize, zero: V) -> Result<Vec<V>, String> {
+        match len.checked_mul(size_of::<V>()) {
+            Some(nbytes) if nbytes as u64 <= self.remaining => {
+                let mut v = vec![zero; len];
+                self.fill(as_bytes_mut(&mut v))?;
+                Ok(v)
+            }
+            _ => Err("unexpected end of snapshot".to_string()),
+        }
+    }
+
+    fn values<T: FloatT>(&mut self, len: usize) -> Result<Vec<T>, String> {
+        self.array(len, T::zero())
+    }
+
+    fn vector<T: FloatT>(&mut self) -> Result<Vec<T>, String> {
+        let len = self.u64()?;
+        self.values(len)
+    }
+
+    // Indices are stored as u64, which is usize itself on 64-bit targets
+    fn indices(&mut self, len: usize) -> Result<Vec<usize>, String> {
+        if size_of::<usize>() == size_of::<u64>() {
+            return self.array(len, 0usize);
+        }
+        let wide = self.array(len, 0u64)?;
+        wide.into_iter()
+            .map(|i| usize::try_from(i).map_err(|_| "snapshot index too large".to_string()))
+            .collect()
+    }
+
+    fn matrix<T: FloatT>(&mut self) -> Result<CscMatrix<T>, String> {
+        let m = self.u64()?;
+        let n = self.u64()?;
+        let nnz = self.u64()?;
+        let colptr = self.indices(n.checked_add(1).ok_or("snapshot matrix too large")?)?;
+        let rowval = self.indices(nnz)?;
+        let nzval = self.values(nnz)?;
+        if colptr.first() != Some(&0)
+            || colptr.last() != Some(&nnz)
+            || !colptr.windows(2).all(|w| w[0] <= w[1])
+            || !rowval.iter().all(|&i| i < m)
+        {
+            return Err("inconsistent CSC matrix in snapshot".to_string());
+        }
+        Ok(CscMatrix { m, n, colptr, rowval, nzval })
+    }
+
+    fn settings<T: FloatT>(&mut self) -> Result<lib::DefaultSettings<T>, String> {
+        let mut s = lib::DefaultSettings::<T>::default();
+        s.max_iter = self.u32()?;
+        s.time_limit = self.f64()?;
+        s.verbose = self.bool()?;
+        s.max_step_fraction = self.real()?;
+        s.tol_gap_abs = self.real()?;
+        s.tol_gap_rel = self.real()?;
+        s.tol_feas = self.real()?;
+        s.tol_infeas_abs = self.real()?;
+        s.tol_infeas_rel = self.real()?;
+        s.tol_ktratio = self.real()?;
+        s.reduced_tol_gap_abs = self.real()?;
+        s.reduced_tol_gap_rel = self.real()?;
+        s.reduced_tol_feas = self.real()?;
+        s.reduced_tol_infeas_abs = self.real()?;
+        s.reduced_tol_infeas_rel = self.real()?;
+        s.reduced_tol_ktratio = self.real()?;
+        s.equilibrate_enable = self.bool()?;
+        s.equilibrate_max_iter = self.u32()?;
+        s.equilibrate_min_scaling = self.real()?;
+        s.equilibrate_max_scaling = self.real()?;
+        s.linesearch_backtrack_step = self.real()?;
+        s.min_switch_step_length = self.real()?;
+        s.min_terminate_step_length = self.real()?;
+        s.max_threads = self.u32()?;
+        s.direct_kkt_solver = self.bool()?;
+        s.direct_solve_method = self.tag(&DIRECT_SOLVE_METHODS)?;
+        s.static_regularization_enable = self.bool()?;
+        s.static_regularization_constant = self.real()?;
+        s.static_regularization_proportional = self.real()?;
+        s.dynamic_regularization_enable = self.bool()?;
+        s.dynamic_regularization_eps = self.real()?;
+        s.dynamic_regularization_delta = self.real()?;
+        s.iterative_refinement_enable = self.bool()?;
+        s.iterative_refinement_reltol = self.real()?;
+        s.iterative_refinement_abstol = self.real()?;
+        s.iterative_refinement_max_iter = self.u32()?;
+        s.iterative_refinement_stop_ratio = self.real()?;
+        s.presolve_enable = self.bool()?;
+        #[cfg(feature = "sdp")]
+        {
+            s.chordal_decomposition_enable = self.bool()?;
+            s.chordal_decomposition_merge_method = self.tag(&MERGE_METHODS)?;
+            s.chordal_decomposition_compact = self.bool()?;
+            s.chordal_decomposition_complete_dual = self.bool()?;
+        }
+        Ok(s)
+    }
+
+    fn cone<T: FloatT>(&mut self) -> Result<lib::SupportedConeT<T>, String> {
+        Ok(match self.u32()? {
+            TAG_ZERO => lib::SupportedConeT::ZeroConeT(self.u64()?),
+            TAG_NONNEGATIVE => lib::SupportedConeT::NonnegativeConeT(self.u64()?),
+            TAG_SECOND_ORDER => lib::SupportedConeT::SecondOrderConeT(self.u64()?),
+            TAG_EXPONENTIAL => lib::SupportedConeT::ExponentialConeT(),
+            TAG_POWER => lib::SupportedConeT::PowerConeT(self.real()?),
+            TAG_GENPOWER => {
+                let alpha = self.vector()?;
+                lib::SupportedConeT::GenPowerConeT(alpha, self.u64()?)
+            }
+            #[cfg(feature = "sdp")]
+            TAG_PSD_TRIANGLE => lib::SupportedConeT::PSDTriangleConeT(self.u64()?),
+            tag => return Err(format!("unsupported cone type {} in snapshot", tag)),
+        })
+    }
+}
+
+fn _encode_snapshot<T: FloatT, W: Write>(
+    out: W,
+    problem: &ProblemData<T>,
+    settings: &lib::DefaultSettings<T>,
+) -> io::Result<()> {
+    let mut w = Writer { out };
+    w.out.write_all(MAGIC)?;
+    w.u32(VERSION)?;
+    w.u32(ENDIAN_MARKER)?;
+    w.u32(size_of::<T>() as u32)?;
+    w.u32(FEATURES)?;
+    w.settings(settings)?;
+
+    w.matrix(&problem.P)?;
+    w.vector(&problem.q)?;
+    w.matrix(&problem.A)?;
+    w.vector(&problem.b)?;
+
+    w.u64(problem.cones.len())?;
+    for cone in &problem.cones {
+        w.cone(cone)?;
+    }
+    w.out.flush()
+}
+
+// The decoded contents of a snapshot
+struct Snapshot<T: FloatT> {
+    P: CscMatrix<T>,
+    q: Vec<T>,
+    A: CscMatrix<T>,
+    b: Vec<T>,
+    cones: Vec<lib::SupportedConeT<T>>,
+    settings: lib::DefaultSettings<T>,
+}
+
+fn _decode_snapshot<T: FloatT, R: Read>(input: R, len: u64) -> Result<Snapshot<T>, String> {
+    let mut r = Reader { input, remaining: len };
+
+    if r.take::<8>()? != *MAGIC {
+        return Err("not a Clarabel snapshot".to_string());
+    }
+    if r.u32()? != VERSION {
+        return Err("unsupported snapshot version".to_string());
+    }
+    if r.u32()? != ENDIAN_MARKER {
+        return Err("snapshot was written on a machine with different endianness".to_string());
+    }
+    if r.u32()? as usize != size_of::<T>() {
+        return Err("snapshot was written with a different float type".to_string());
+    }
+    if r.u32()? != FEATURES {
+        return Err("snapshot was written by a build with different features".to_string());
+    }
+    let settings = r.settings::<T>()?;
+
+    let P = r.matrix::<T>()?;
+    let q = r.vector::<T>()?;
+    let A = r.matrix::<T>()?;
+    let b = r.vector::<T>()?;
+
+    let ncones = r.u64()?;
+    let mut cones = Vec::with_capacity(ncones.min(r.remaining as usize));
+    for _ in 0..ncones {
+        cones.push(r.cone::<T>()?);
+    }
+
+    Ok(Snapshot { P, q, A, b, cones, settings })
+}
+
+unsafe fn _filename<'a>(filename: *const c_char) -> Option<&'a str> {
+    if filename.is_null() {
+        return None;
+    }
+    std::ffi::CStr::from_ptr(filename).to_str().ok()
+}
+
+/// Write the problem data and settings of a solver to a binary snapshot.
+///
+/// Returns false if the solver holds no problem data or the file could not be
+/// written.
+unsafe fn _internal_DefaultSolver_save_binary<T: FloatT>(
+    solver: *mut c_void,
+    filename: *const c_char,
+) -> bool {
+    let filename = match _filename(filename) {
+        Some(filename) => filename,
+        None => return false,
+    };
+
+    // Recover the solver object from the opaque pointer
+    let solver = DefaultSolverHandle::<T>::from_raw(solver);
+
+    let problem = match &solver.problem {
+        Some(problem) => problem,
+        None => return false,
+    };
+    std::fs::File::create(filename)
+        .and_then(|file| _encode_snapshot(BufWriter::new(file), problem, &solver.settings))
+        .is_ok()
+}
+
+/// Build a solver from a binary snapshot.  Settings stored in the snapshot
+/// are used unless `settings` is non-null.  Returns null on failure.
+unsafe fn _internal_DefaultSolver_load_binary<T: FloatT>(
+    filename: *const c_char,
+    settings: *const ClarabelDefaultSettings<T>,
+) -> *mut c_void {
+    let filename = match _filename(filename) {
+        Some(filename) => filename,
+        None => return std::ptr::null_mut(),
+    };
+
+    let snapshot = std::fs::File::open(filename)
+        .and_then(|file| Ok((file.metadata()?.len(), file)))
+        .map_err(|e| e.to_string())
+        .and_then(|(len, file)| _decode_snapshot::<T, _>(BufReader::new(file), len));
+    let snapshot = match snapshot {
+        Ok(snapshot) => snapshot,
+        Err(e) => {
+            println!("Error loading snapshot {}: {}", filename, e);
+            return std::ptr::null_mut();
+        }
+    };
+    let Snapshot { P, q, A, b, cones, settings: stored_settings } = snapshot;
+    let mut settings: lib::DefaultSettings<T> = match settings.is_null() {
+        true => stored_settings,
+        false => (*settings).clone().into(),
+    };
+    settings.max_threads = executor::solver_threads(settings.max_threads);
+
+    let start = Instant::now();
+    let solver = lib::DefaultSolver::<T>::new(&P, &q, &A, &b, &cones, settings);
+    let setup_time = start.elapsed().as_secs_f64();
+
+    match solver {
+        Ok(solver) => DefaultSolverHandle::new(solver, setup_time)
+            .with_problem(ProblemData::from_parts(P, q, A, b, cones))
+            .into_raw(),
+        Err(e) => {
+            println!("Error creating DefaultSolver: {:?}", e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_save_binary(
+    solver: *mut ClarabelDefaultSolver_f64,
+    filename: *const c_char,
+) -> bool {
+    _internal_DefaultSolver_save_binary::<f64>(solver, filename)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_save_binary(
+    solver: *mut ClarabelDefaultSolver_f32,
+    filename: *const c_char,
+) -> bool {
+    _internal_DefaultSolver_save_binary::<f32>(solver, filename)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_load_binary(
+    filename: *const c_char,
+    settings: *const ClarabelDefaultSettings<f64>,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_load_binary::<f64>(filename, settings)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_load_binary(
+    filename: *const c_char,
+    settings: *const ClarabelDefaultSettings<f32>,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_load_binary::<f32>(filename, settings)
+}
@@ -1,20 +1,26 @@
 #![allow(non_snake_case)]
 #![allow(non_camel_case_types)]
 
-use crate::algebra::ClarabelCscMatrix;
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
 use crate::core::cones::ClarabelSupportedConeT;
+use crate::executor;
 use crate::solver::implementations::default::settings::{
-    ClarabelDefaultSettings, ClarabelDefaultSettings_f32, ClarabelDefaultSettings_f64,
+    settings_from_handle, ClarabelDefaultSettings, ClarabelDefaultSettingsHandle_f32,
+    ClarabelDefaultSettingsHandle_f64, ClarabelDefaultSettings_f32, ClarabelDefaultSettings_f64,
 };
 use crate::utils;
 use clarabel::solver::ffi::SolverStatusFFI;
 
-use clarabel::algebra::FloatT;
+use clarabel::algebra::{CscMatrix, FloatT};
 use clarabel::io::ConfigurablePrintTarget;
-use clarabel::solver::{self as lib, IPSolver};
+use clarabel::solver::{self as lib};
 
 use std::ffi::c_char;
+use std::io::Write;
 use std::slice;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Arc;
+use std::time::Instant;
 use std::{ffi::c_void, mem::forget};
 
 cfg_if::cfg_if! {
@@ -24,6 +30,7 @@ cfg_if::cfg_if! {
     }
 }
 
+use super::handle::{DefaultSolverHandle, ProblemData};
 use super::info::ClarabelDefaultInfo;
 use super::solution::DefaultSolution;
 
@@ -32,10 +39,23 @@ pub type ClarabelDefaultSolver_f64 = c_void;
 
 pub type ClarabelSolverStatus = SolverStatusFFI;
 
+// Convert the DefaultSettings struct passed from C into Rust settings
+pub(crate) unsafe fn _settings_from_C<T: FloatT>(settings: *const ClarabelDefaultSettings<T>) -> lib::DefaultSettings<T> {
+    (*settings).clone().into()
+}
+
+// Settings from a handle made by clarabel_DefaultSettings_*_compile, already converted
+// and validated.  Clarabel.rs takes ownership of its settings, so this is a plain copy.
+unsafe fn _settings_from_handle<T: FloatT>(settings: *const c_void) -> lib::DefaultSettings<T> {
+    settings_from_handle::<T>(settings).clone()
+}
+
 // Wrapper function to create a DefaultSolver object from C using dynamic memory allocation
 // - Matrices and vectors are constructed from raw pointers
 // - Cones are converted from C struct to Rust struct
-// - Settings are converted from C struct to Rust struct
+// - Settings are converted from C struct to Rust struct by the caller, see _settings_from_C
+//
+// - keep_problem keeps a copy of the problem data in the handle, see DefaultSolverHandle::problem
 //
 // b and cones are allowed to be null pointers, in which case they form zero-length slices and this is consistent with Clarabel.rs.
 unsafe fn _internal_DefaultSolver_new<T: FloatT>(
@@ -45,7 +65,8 @@ unsafe fn _internal_DefaultSolver_new<T: FloatT>(
     b: *const T,                    // Array of double from C
     n_cones: usize,                 // Number of cones
     cones: *const ClarabelSupportedConeT<T>,
-    settings: *const ClarabelDefaultSettings<T>,
+    settings: lib::DefaultSettings<T>,
+    keep_problem: bool,
 ) -> *mut c_void {
     // Check null pointers
     debug_assert!(!P.is_null(), "Pointer P must not be null");
@@ -58,6 +79,62 @@ unsafe fn _internal_DefaultSolver_new<T: FloatT>(
     // Recover the matrices from C structs
     let P = utils::convert_from_C_CscMatrix(P);
     let A = utils::convert_from_C_CscMatrix(A);
+
+    let solver = _internal_DefaultSolver_build(&P, q, &A, b, n_cones, cones, settings, keep_problem);
+
+    // Ensure Rust does not free the memory of arrays managed by C
+    forget(P);
+    forget(A);
+
+    solver
+}
+
+// As _internal_DefaultSolver_new, for matrices with 32-bit indices.  The indices are
+// widened once here, directly into the form Clarabel.rs takes.
+unsafe fn _internal_DefaultSolver_new_i32<T: FloatT>(
+    P: *const ClarabelCscMatrix_i32<T>,
+    q: *const T,
+    A: *const ClarabelCscMatrix_i32<T>,
+    b: *const T,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+    settings: lib::DefaultSettings<T>,
+    keep_problem: bool,
+) -> *mut c_void {
+    // Check null pointers
+    debug_assert!(!P.is_null(), "Pointer P must not be null");
+    debug_assert!(!q.is_null(), "Pointer q must not be null");
+    debug_assert!(!A.is_null(), "Pointer A must not be null");
+    if P.is_null() || q.is_null() || A.is_null() {
+        return std::ptr::null_mut();
+    }
+
+    // Recover the matrices from C structs
+    let P = utils::convert_from_C_CscMatrix_i32(P);
+    let A = utils::convert_from_C_CscMatrix_i32(A);
+
+    let solver = _internal_DefaultSolver_build(&P, q, &A, b, n_cones, cones, settings, keep_problem);
+
+    // Free the widened indices, but leave the values to C
+    utils::release_C_CscMatrix_i32(P);
+    utils::release_C_CscMatrix_i32(A);
+
+    solver
+}
+
+// Builds the solver handle from matrices already recovered from C
+pub(crate) unsafe fn _internal_DefaultSolver_build<T: FloatT>(
+    P: &CscMatrix<T>,
+    q: *const T,
+    A: &CscMatrix<T>,
+    b: *const T,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+    mut settings: lib::DefaultSettings<T>,
+    keep_problem: bool,
+) -> *mut c_void {
+    settings.max_threads = executor::solver_threads(settings.max_threads);
+
     // Recover the arrays from C pointers and deduce their lengths from the matrix dimensions
     let q = match q.is_null() {
         true => Vec::new(),
@@ -68,9 +145,6 @@ unsafe fn _internal_DefaultSolver_new<T: FloatT>(
         false => Vec::from_raw_parts(b as *mut T, A.m, A.m),
     };
 
-    // Get a reference to the DefaultSettings struct from the pointer passed from C
-    let settings = (*settings).clone().into();
-
     // Convert the cones from C to Rust
     let cones = match cones.is_null() {
         true => Vec::new(),
@@ -83,20 +157,27 @@ unsafe fn _internal_DefaultSolver_new<T: FloatT>(
     // Create the solver
     // This is dropped at the end of the function because it exists on the Rust side only,
     // and cones and settings are created on the Rust side.
-    let solver = lib::DefaultSolver::<T>::new(&P, &q, &A, &b, &cones, settings);
+    let start = Instant::now();
+    let solver = lib::DefaultSolver::<T>::new(P, &q, A, &b, &cones, settings);
+    let setup_time = start.elapsed().as_secs_f64();
+    let solver = solver.map(|solver| {
+        let handle = DefaultSolverHandle::new(solver, setup_time);
+        match keep_problem {
+            true => handle.with_problem(ProblemData::new(P, &q, A, &b, cones)),
+            false => handle,
+        }
+    });
 
     // Ensure Rust does not free the memory of arrays managed by C
     // Should be fine to forget vectors that were created as zero-length
     // vecs when receiving null pointers, since rust vec::new() should
     // not allocate memory for zero-length vectors.
-    forget(P);
-    forget(A);
     forget(q);
     forget(b);
 
     // Solver should be a Result<DefaultSolver<T>, SolverError>
     match solver {
-        Ok(solver) => Box::into_raw(Box::new(solver)) as *mut c_void,
+        Ok(solver) => solver.into_raw(),
         Err(e) => {
             // Just print an error here and return a null pointer
             // This could surely done in a more graceful way
@@ -116,7 +197,7 @@ pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new(
     cones: *const ClarabelSupportedConeT<f64>,
     settings: *const ClarabelDefaultSettings_f64,
 ) -> *mut ClarabelDefaultSolver_f64 {
-    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, settings)
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_C(settings), false)
 }
 
 #[no_mangle]
@@ -129,13 +210,143 @@ pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new(
     cones: *const ClarabelSupportedConeT<f32>,
     settings: *const ClarabelDefaultSettings_f32,
 ) -> *mut ClarabelDefaultSolver_f32 {
-    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, settings)
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_C(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new_i32(
+    P: *const ClarabelCscMatrix_i32<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix_i32<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+    settings: *const ClarabelDefaultSettings_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_C(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new_i32(
+    P: *const ClarabelCscMatrix_i32<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix_i32<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+    settings: *const ClarabelDefaultSettings_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_C(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new_keep_data(
+    P: *const ClarabelCscMatrix<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+    settings: *const ClarabelDefaultSettings_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_C(settings), true)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new_i32_keep_data(
+    P: *const ClarabelCscMatrix_i32<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix_i32<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+    settings: *const ClarabelDefaultSettings_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_C(settings), true)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new_keep_data(
+    P: *const ClarabelCscMatrix<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+    settings: *const ClarabelDefaultSettings_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_C(settings), true)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new_i32_keep_data(
+    P: *const ClarabelCscMatrix_i32<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix_i32<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+    settings: *const ClarabelDefaultSettings_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_C(settings), true)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new_with_settings_handle(
+    P: *const ClarabelCscMatrix<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+    settings: *const ClarabelDefaultSettingsHandle_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_handle::<f64>(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new_with_settings_handle(
+    P: *const ClarabelCscMatrix<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+    settings: *const ClarabelDefaultSettingsHandle_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_new(P, q, A, b, n_cones, cones, _settings_from_handle::<f32>(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_new_i32_with_settings_handle(
+    P: *const ClarabelCscMatrix_i32<f64>,
+    q: *const f64,
+    A: *const ClarabelCscMatrix_i32<f64>,
+    b: *const f64,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+    settings: *const ClarabelDefaultSettingsHandle_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_handle::<f64>(settings), false)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_new_i32_with_settings_handle(
+    P: *const ClarabelCscMatrix_i32<f32>,
+    q: *const f32,
+    A: *const ClarabelCscMatrix_i32<f32>,
+    b: *const f32,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+    settings: *const ClarabelDefaultSettingsHandle_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_new_i32(P, q, A, b, n_cones, cones, _settings_from_handle::<f32>(settings), false)
 }
 
 // Wrapper function to call DefaultSolver.solve() from C
 fn _internal_DefaultSolver_solve<T: FloatT>(solver: *mut c_void) {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Use the recovered solver object
     solver.solve();
@@ -152,10 +363,10 @@ pub extern "C" fn clarabel_DefaultSolver_f32_solve(solver: *mut ClarabelDefaultS
 }
 
 // Function to free the memory of the solver object
-unsafe fn _internal_DefaultSolver_free<T: FloatT>(solver: *mut c_void) {
+pub(crate) unsafe fn _internal_DefaultSolver_free<T: FloatT>(solver: *mut c_void) {
     if !solver.is_null() {
         // Reconstruct the box to drop the solver object
-        let boxed = Box::from_raw(solver as *mut lib::DefaultSolver<T>);
+        let boxed = Box::from_raw(solver as *mut DefaultSolverHandle<T>);
         drop(boxed);
     }
 }
@@ -175,9 +386,10 @@ where
     T: FloatT,
 {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Use the recovered solver object
+    solver.print_written = None;
     solver.print_to_stdout();
 }
 
@@ -210,9 +422,10 @@ where
     let file = std::fs::File::create(filename).expect("File not found");
 
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Use the recovered solver object
+    solver.print_written = None;
     solver.print_to_file(file);
 }
 
@@ -237,9 +450,10 @@ where
     T: FloatT,
 {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Use the recovered solver object
+    solver.print_written = None;
     solver.print_to_buffer();
 }
 
@@ -262,7 +476,7 @@ where
     T: FloatT,
 {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
     let out = solver.get_print_buffer().unwrap_or("".to_string());
     let c_str = std::ffi::CString::new(out).unwrap();
     // Return the string as a raw pointer.  It must be returned to
@@ -293,6 +507,165 @@ pub unsafe extern "C" fn clarabel_free_print_buffer(ptr: *const c_char) {
     }
 }
 
+// Print target writing into a fixed region owned by the caller.  Output past
+// the capacity is dropped, and no allocation happens per write.
+struct FixedBufferWriter {
+    buffer: *mut u8,
+    capacity: usize,
+    written: Arc<AtomicUsize>,
+}
+
+// The buffer is owned by the caller, who must keep it alive and not access it
+// concurrently with a solve.
+unsafe impl Send for FixedBufferWriter {}
+unsafe impl Sync for FixedBufferWriter {}
+
+impl Write for FixedBufferWriter {
+    fn write(&mut self, buf: &[u8]) -> std::io::Result<usize> {
+        let written = self.written.load(Ordering::Relaxed);
+        let count = buf.len().min(self.capacity - written);
+        if count > 0 {
+            unsafe {
+                std::ptr::copy_nonoverlapping(buf.as_ptr(), self.buffer.add(written), count);
+            }
+            self.written.store(written + count, Ordering::Relaxed);
+        }
+        // report everything as written so that the solver does not fail on
+        // a full buffer
+        Ok(buf.len())
+    }
+
+    fn flush(&mut self) -> std::io::Result<()> {
+        Ok(())
+    }
+}
+
+pub type ClarabelPrintCallback =
+    extern "C" fn(data: *const c_char, len: usize, userdata: *mut c_void);
+
+// Print target forwarding each chunk of output to a C callback
+struct CallbackWriter {
+    callback: ClarabelPrintCallback,
+    userdata: *mut c_void,
+}
+
+// The userdata pointer is owned by the caller, as for termination callbacks
+unsafe impl Send for CallbackWriter {}
+unsafe impl Sync for CallbackWriter {}
+
+impl Write for CallbackWriter {
+    fn write(&mut self, buf: &[u8]) -> std::io::Result<usize> {
+        if !buf.is_empty() {
+            (self.callback)(buf.as_ptr() as *const c_char, buf.len(), self.userdata);
+        }
+        Ok(buf.len())
+    }
+
+    fn flush(&mut self) -> std::io::Result<()> {
+        Ok(())
+    }
+}
+
+fn _internal_DefaultSolver_print_to_fixed_buffer<T>(
+    solver: *mut c_void,
+    buffer: *mut c_char,
+    capacity: usize,
+) where
+    T: FloatT,
+{
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    let capacity = if buffer.is_null() { 0 } else { capacity };
+    let written = Arc::new(AtomicUsize::new(0));
+    solver.print_written = Some(written.clone());
+    solver.print_to_stream(Box::new(FixedBufferWriter {
+        buffer: buffer as *mut u8,
+        capacity,
+        written,
+    }));
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_print_to_fixed_buffer(
+    solver: *mut ClarabelDefaultSolver_f64,
+    buffer: *mut c_char,
+    capacity: usize,
+) {
+    _internal_DefaultSolver_print_to_fixed_buffer::<f64>(solver, buffer, capacity);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_print_to_fixed_buffer(
+    solver: *mut ClarabelDefaultSolver_f32,
+    buffer: *mut c_char,
+    capacity: usize,
+) {
+    _internal_DefaultSolver_print_to_fixed_buffer::<f32>(solver, buffer, capacity);
+}
+
+fn _internal_DefaultSolver_fixed_buffer_len<T>(solver: *mut c_void) -> usize
+where
+    T: FloatT,
+{
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver
+        .print_written
+        .as_ref()
+        .map_or(0, |written| written.load(Ordering::Relaxed))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_fixed_buffer_len(
+    solver: *mut ClarabelDefaultSolver_f64,
+) -> usize {
+    _internal_DefaultSolver_fixed_buffer_len::<f64>(solver)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_fixed_buffer_len(
+    solver: *mut ClarabelDefaultSolver_f32,
+) -> usize {
+    _internal_DefaultSolver_fixed_buffer_len::<f32>(solver)
+}
+
+fn _internal_DefaultSolver_print_to_callback<T>(
+    solver: *mut c_void,
+    callback: Option<ClarabelPrintCallback>,
+    userdata: *mut c_void,
+) where
+    T: FloatT,
+{
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.print_written = None;
+    match callback {
+        Some(callback) => solver.print_to_stream(Box::new(CallbackWriter { callback, userdata })),
+        None => solver.print_to_stream(Box::new(std::io::sink())),
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f64_print_to_callback(
+    solver: *mut ClarabelDefaultSolver_f64,
+    callback: Option<ClarabelPrintCallback>,
+    userdata: *mut c_void,
+) {
+    _internal_DefaultSolver_print_to_callback::<f64>(solver, callback, userdata);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_DefaultSolver_f32_print_to_callback(
+    solver: *mut ClarabelDefaultSolver_f32,
+    callback: Option<ClarabelPrintCallback>,
+    userdata: *mut c_void,
+) {
+    _internal_DefaultSolver_print_to_callback::<f32>(solver, callback, userdata);
+}
+
 #[cfg(feature = "serde")]
 pub unsafe fn _internal_DefaultSolver_load_from_file<T>(
     filename: *const c_char,
@@ -311,13 +684,16 @@ where
     };
     let mut file = std::fs::File::open(filename).expect("File not found");
 
+    let start = Instant::now();
     let solver = if settings.is_null() {
+        // the settings stored in the file are used as saved
         lib::DefaultSolver::<T>::load_from_file(&mut file, None)
     } else {
-        let settings = (*settings).clone().into();
+        let mut settings: lib::DefaultSettings<T> = (*settings).clone().into();
+        settings.max_threads = executor::solver_threads(settings.max_threads);
         lib::DefaultSolver::<T>::load_from_file(&mut file, Some(settings))
     };
-    Box::into_raw(Box::new(solver)) as *mut c_void
+    DefaultSolverHandle::new(solver, start.elapsed().as_secs_f64()).into_raw()
 }
 
 #[cfg(feature = "serde")]
@@ -336,7 +712,7 @@ where
     let mut file = std::fs::File::create(filename).expect("File not found");
 
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Use the recovered solver object
     solver.save_to_file(&mut file).unwrap();
@@ -378,12 +754,93 @@ pub extern "C" fn clarabel_DefaultSolver_f32_save_to_file(
     _internal_DefaultSolver_save_to_file::<f32>(solver, filename);
 }
 
+/// Create an independent copy of a DefaultSolver object.
+///
+/// The copy is built from the current problem data and settings of the
+/// original, so it repeats the setup phase.  Returns null if the solver
+/// holds no problem data (loaded from file) or the setup fails.
+fn _internal_DefaultSolver_clone<T: FloatT>(solver: *mut c_void) -> *mut c_void {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    match solver.try_clone() {
+        Some(clone) => clone.into_raw(),
+        None => std::ptr::null_mut(),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_clone(
+    solver: *mut ClarabelDefaultSolver_f64,
+) -> *mut ClarabelDefaultSolver_f64 {
+    _internal_DefaultSolver_clone::<f64>(solver)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_clone(
+    solver: *mut ClarabelDefaultSolver_f32,
+) -> *mut ClarabelDefaultSolver_f32 {
+    _internal_DefaultSolver_clone::<f32>(solver)
+}
+
+/// Lock or unlock the sparsity pattern of P and A.
+///
+/// Data updates only ever refactor the KKT system numerically, reusing the
+/// symbolic analysis from construction, and Clarabel.rs rejects CSC updates
+/// whose pattern differs from the solver's.  When locked, solvers that keep a
+/// copy of the problem data also check CSC updates against it before the
+/// solver sees them.  Recording no pattern up front keeps construction free of
+/// index passes for solvers that never lock.
+fn _internal_DefaultSolver_set_pattern_locked<T: FloatT>(solver: *mut c_void, locked: bool) {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.pattern_locked = locked;
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_set_pattern_locked(
+    solver: *mut ClarabelDefaultSolver_f64,
+    locked: bool,
+) {
+    _internal_DefaultSolver_set_pattern_locked::<f64>(solver, locked)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_set_pattern_locked(
+    solver: *mut ClarabelDefaultSolver_f32,
+    locked: bool,
+) {
+    _internal_DefaultSolver_set_pattern_locked::<f32>(solver, locked)
+}
+
+fn _internal_DefaultSolver_pattern_locked<T: FloatT>(solver: *mut c_void) -> bool {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.pattern_locked
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_pattern_locked(
+    solver: *mut ClarabelDefaultSolver_f64,
+) -> bool {
+    _internal_DefaultSolver_pattern_locked::<f64>(solver)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_pattern_locked(
+    solver: *mut ClarabelDefaultSolver_f32,
+) -> bool {
+    _internal_DefaultSolver_pattern_locked::<f32>(solver)
+}
+
 /// Get the solution field from a DefaultSolver object.
 ///
 /// The solution is returned as a C struct.
 fn _internal_DefaultSolver_solution<T: FloatT>(solver: *mut c_void) -> DefaultSolution<T> {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Get the solution and convert to C struct
     DefaultSolution::<T>::from(&mut solver.solution)
@@ -403,10 +860,71 @@ pub extern "C" fn clarabel_DefaultSolver_f32_solution(
     _internal_DefaultSolver_solution::<f32>(solver)
 }
 
+/// Copy the solution vectors of a DefaultSolver object into caller-owned buffers.
+///
+/// Each of x, z and s may be a null pointer, in which case that vector is skipped.
+/// n is the length of x and m the length of z and s.  Nothing is copied and false
+/// is returned if a non-null buffer does not match the length of its vector.
+fn _internal_DefaultSolver_copy_solution<T: FloatT>(
+    solver: *mut c_void,
+    x: *mut T,
+    n: usize,
+    z: *mut T,
+    s: *mut T,
+    m: usize,
+) -> bool {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+    let solution = &solver.solution;
+
+    if (!x.is_null() && n != solution.x.len())
+        || (!z.is_null() && m != solution.z.len())
+        || (!s.is_null() && m != solution.s.len())
+    {
+        return false;
+    }
+
+    let copy_into = |src: &[T], dst: *mut T| {
+        if !dst.is_null() {
+            let dst = unsafe { slice::from_raw_parts_mut(dst, src.len()) };
+            dst.copy_from_slice(src);
+        }
+    };
+
+    copy_into(&solution.x, x);
+    copy_into(&solution.z, z);
+    copy_into(&solution.s, s);
+    true
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_copy_solution(
+    solver: *mut ClarabelDefaultSolver_f64,
+    x: *mut f64,
+    n: usize,
+    z: *mut f64,
+    s: *mut f64,
+    m: usize,
+) -> bool {
+    _internal_DefaultSolver_copy_solution::<f64>(solver, x, n, z, s, m)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_copy_solution(
+    solver: *mut ClarabelDefaultSolver_f32,
+    x: *mut f32,
+    n: usize,
+    z: *mut f32,
+    s: *mut f32,
+    m: usize,
+) -> bool {
+    _internal_DefaultSolver_copy_solution::<f32>(solver, x, n, z, s, m)
+}
+
 /// Get the info field from a DefaultSolver object.
 fn _internal_DefaultSolver_info<T: FloatT>(solver: *mut c_void) -> ClarabelDefaultInfo<T> {
     // Recover the solver object from the opaque pointer
-    let solver = unsafe { &mut *(solver as *mut lib::DefaultSolver<T>) };
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
 
     // Get the info field and convert it to a C struct.
     ClarabelDefaultInfo::<T>::from(solver.info.clone())
@@ -0,0 +1,79 @@
+#![allow(non_snake_case)]
+#![allow(non_camel_case_types)]
+
+use super::handle::DefaultSolverHandle;
+use super::solver::*;
+use clarabel::algebra::FloatT;
+use std::ffi::c_void;
+
+/// Wall clock timings and counters accumulated over the lifetime of a solver.
+///
+/// All times are in seconds.  The counters are a handful of clock reads per
+/// call and are always enabled.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct ClarabelDefaultTimings {
+    /// Solver construction: presolve, equilibration, KKT assembly and factorisation
+    pub setup_time: f64,
+    /// Total time spent in solve()
+    pub solve_time: f64,
+    /// Time spent in the most recent solve()
+    pub last_solve_time: f64,
+    /// Total time spent in data updates
+    pub update_time: f64,
+    /// Number of calls to solve()
+    pub solve_count: u32,
+    /// Number of data updates
+    pub update_count: u32,
+    /// Total interior point iterations, each with one numeric KKT factorisation
+    pub iterations: u32,
+    /// Number of symbolic KKT analyses (ordering and elimination tree): one for
+    /// building the solver, plus those of the solver it was cloned from.  Data
+    /// updates and solves never add to this.
+    pub symbolic_count: u32,
+}
+
+/// Get the accumulated timings from a DefaultSolver object.
+fn _internal_DefaultSolver_timings<T: FloatT>(solver: *mut c_void) -> ClarabelDefaultTimings {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.timings
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_timings(
+    solver: *mut ClarabelDefaultSolver_f64,
+) -> ClarabelDefaultTimings {
+    _internal_DefaultSolver_timings::<f64>(solver)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_timings(
+    solver: *mut ClarabelDefaultSolver_f32,
+) -> ClarabelDefaultTimings {
+    _internal_DefaultSolver_timings::<f32>(solver)
+}
+
+/// Reset the solve and update counters of a DefaultSolver object.  The
+/// setup time and symbolic count are kept.
+fn _internal_DefaultSolver_reset_timings<T: FloatT>(solver: *mut c_void) {
+    // Recover the solver object from the opaque pointer
+    let solver = unsafe { DefaultSolverHandle::<T>::from_raw(solver) };
+
+    solver.timings = ClarabelDefaultTimings {
+        setup_time: solver.timings.setup_time,
+        symbolic_count: solver.timings.symbolic_count,
+        ..Default::default()
+    };
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f64_reset_timings(solver: *mut ClarabelDefaultSolver_f64) {
+    _internal_DefaultSolver_reset_timings::<f64>(solver)
+}
+
+#[no_mangle]
+pub extern "C" fn clarabel_DefaultSolver_f32_reset_timings(solver: *mut ClarabelDefaultSolver_f32) {
+    _internal_DefaultSolver_reset_timings::<f32>(solver)
+}
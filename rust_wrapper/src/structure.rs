@@ -0,0 +1,295 @@
+#![allow(non_snake_case)]
+
+//! Fingerprints of the problem structure: the dimensions and sparsity patterns
+//! of P and A and the cone list.  Numeric values in P, A, q and b are ignored.
+//!
+//! The hash is defined in terms of the index values widened to 64 bits, so it is
+//! the same for every index width and platform, and across releases.
+
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
+use crate::core::cones::ClarabelSupportedConeT;
+use clarabel::algebra::FloatT;
+use std::slice;
+
+// Multipliers of the xxHash64 round and avalanche functions
+const PRIME1: u64 = 0x9E37_79B1_85EB_CA87;
+const PRIME2: u64 = 0xC2B2_AE3D_27D4_EB4F;
+const PRIME3: u64 = 0x1656_67B1_9E37_79F9;
+
+// Independent accumulators for the index arrays.  Consecutive indices go to
+// different lanes, so the rounds of a block do not depend on each other and the
+// loop vectorizes.
+const LANES: usize = 4;
+
+/// An index type of a CSC matrix, widened to 64 bits for hashing and comparison
+pub(crate) trait PatternIndex: Copy {
+    fn widen(self) -> u64;
+
+    /// The indices as usize without a copy, when they already are
+    fn as_native(idx: &[Self]) -> Option<&[usize]> {
+        let _ = idx;
+        None
+    }
+}
+
+impl PatternIndex for usize {
+    fn widen(self) -> u64 {
+        self as u64
+    }
+
+    fn as_native(idx: &[Self]) -> Option<&[usize]> {
+        Some(idx)
+    }
+}
+
+impl PatternIndex for u32 {
+    fn widen(self) -> u64 {
+        self as u64
+    }
+}
+
+impl PatternIndex for i32 {
+    fn widen(self) -> u64 {
+        self as u32 as u64
+    }
+}
+
+/// True if two index arrays hold the same values, whatever their widths
+pub(crate) fn same_indices<I: PatternIndex, J: PatternIndex>(a: &[I], b: &[J]) -> bool {
+    a.len() == b.len() && a.iter().zip(b).all(|(&x, &y)| x.widen() == y.widen())
+}
+
+// Bit pattern of a cone parameter
+fn value_bits<T: FloatT>(value: &T) -> u64 {
+    let bytes = unsafe { slice::from_raw_parts(value as *const T as *const u8, std::mem::size_of::<T>()) };
+    match bytes.len() {
+        4 => u32::from_ne_bytes(bytes.try_into().unwrap()) as u64,
+        _ => u64::from_ne_bytes(bytes.try_into().unwrap()),
+    }
+}
+
+#[inline(always)]
+fn round(acc: u64, value: u64) -> u64 {
+    acc.wrapping_add(value.wrapping_mul(PRIME2)).rotate_left(31).wrapping_mul(PRIME1)
+}
+
+pub(crate) struct StructureHasher {
+    lanes: [u64; LANES],
+}
+
+impl StructureHasher {
+    pub fn new() -> Self {
+        Self {
+            lanes: [
+                PRIME1.wrapping_add(PRIME2),
+                PRIME2,
+                0,
+                PRIME1.wrapping_neg(),
+            ],
+        }
+    }
+
+    pub fn write(&mut self, value: u64) {
+        self.lanes[0] = round(self.lanes[0], value);
+    }
+
+    pub fn write_indices<I: PatternIndex>(&mut self, idx: &[I]) {
+        self.write(idx.len() as u64);
+        let mut lanes = self.lanes;
+        let mut blocks = idx.chunks_exact(LANES);
+        for block in &mut blocks {
+            for k in 0..LANES {
+                lanes[k] = round(lanes[k], block[k].widen());
+            }
+        }
+        for (k, &i) in blocks.remainder().iter().enumerate() {
+            lanes[k] = round(lanes[k], i.widen());
+        }
+        self.lanes = lanes;
+    }
+
+    /// Dimensions and sparsity pattern of a CSC matrix
+    pub fn write_pattern<I: PatternIndex>(&mut self, m: usize, n: usize, colptr: &[I], rowval: &[I]) {
+        self.write(m as u64);
+        self.write(n as u64);
+        self.write_indices(colptr);
+        self.write_indices(rowval);
+    }
+
+    /// Type, dimensions and parameters of each cone
+    pub fn write_cones<T: FloatT>(&mut self, cones: &[ClarabelSupportedConeT<T>]) {
+        self.write(cones.len() as u64);
+        for cone in cones {
+            match cone {
+                ClarabelSupportedConeT::ZeroConeT(dim) => {
+                    self.write(0);
+                    self.write(*dim as u64);
+                }
+                ClarabelSupportedConeT::NonnegativeConeT(dim) => {
+                    self.write(1);
+                    self.write(*dim as u64);
+                }
+                ClarabelSupportedConeT::SecondOrderConeT(dim) => {
+                    self.write(2);
+                    self.write(*dim as u64);
+                }
+                ClarabelSupportedConeT::ExponentialConeT => {
+                    self.write(3);
+                }
+                ClarabelSupportedConeT::PowerConeT(alpha) => {
+                    self.write(4);
+                    self.write(value_bits(alpha));
+                }
+                ClarabelSupportedConeT::GenPowerConeT(alpha, dim1, dim2) => {
+                    self.write(5);
+                    self.write(*dim1 as u64);
+                    self.write(*dim2 as u64);
+                    for alpha in unsafe { slice::from_raw_parts(*alpha, *dim1) } {
+                        self.write(value_bits(alpha));
+                    }
+                }
+                #[cfg(feature = "sdp")]
+                ClarabelSupportedConeT::PSDTriangleConeT(dim) => {
+                    self.write(6);
+                    self.write(*dim as u64);
+                }
+            }
+        }
+    }
+
+    pub fn finish(&self) -> u64 {
+        let [l0, l1, l2, l3] = self.lanes;
+        let mut h = l0
+            .rotate_left(1)
+            .wrapping_add(l1.rotate_left(7))
+            .wrapping_add(l2.rotate_left(12))
+            .wrapping_add(l3.rotate_left(18));
+        h ^= h >> 33;
+        h = h.wrapping_mul(PRIME2);
+        h ^= h >> 29;
+        h = h.wrapping_mul(PRIME3);
+        h ^ (h >> 32)
+    }
+}
+
+// The index arrays of a C matrix, with the lengths taken from colptr
+pub(crate) unsafe fn csc_indices<'a, I: PatternIndex>(n: usize, colptr: *const I, rowval: *const I) -> (&'a [I], &'a [I]) {
+    let colptr = slice::from_raw_parts(colptr, n + 1);
+    let nnz = colptr[n].widen() as usize;
+    let rowval = match rowval.is_null() {
+        true => &[][..],
+        false => slice::from_raw_parts(rowval, nnz),
+    };
+    (colptr, rowval)
+}
+
+unsafe fn _internal_structure_hash<T: FloatT, I: PatternIndex>(
+    P: (usize, usize, *const I, *const I),
+    A: (usize, usize, *const I, *const I),
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<T>,
+) -> u64 {
+    let mut hasher = StructureHasher::new();
+    for (m, n, colptr, rowval) in [P, A] {
+        let (colptr, rowval) = csc_indices(n, colptr, rowval);
+        hasher.write_pattern(m, n, colptr, rowval);
+    }
+    let cones = match cones.is_null() {
+        true => &[][..],
+        false => slice::from_raw_parts(cones, n_cones),
+    };
+    hasher.write_cones(cones);
+    hasher.finish()
+}
+
+unsafe fn _internal_CscMatrix_same_pattern<I: PatternIndex>(
+    A: (usize, usize, *const I, *const I),
+    B: (usize, usize, *const I, *const I),
+) -> bool {
+    if A.0 != B.0 || A.1 != B.1 {
+        return false;
+    }
+    let (colptr_A, rowval_A) = csc_indices(A.1, A.2, A.3);
+    let (colptr_B, rowval_B) = csc_indices(B.1, B.2, B.3);
+    same_indices(colptr_A, colptr_B) && same_indices(rowval_A, rowval_B)
+}
+
+fn _parts<T>(M: &ClarabelCscMatrix<T>) -> (usize, usize, *const usize, *const usize) {
+    (M.m, M.n, M.colptr, M.rowval)
+}
+
+fn _parts_i32<T>(M: &ClarabelCscMatrix_i32<T>) -> (usize, usize, *const i32, *const i32) {
+    (M.m, M.n, M.colptr, M.rowval)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_structure_hash_f64(
+    P: *const ClarabelCscMatrix<f64>,
+    A: *const ClarabelCscMatrix<f64>,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+) -> u64 {
+    _internal_structure_hash(_parts(&*P), _parts(&*A), n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_structure_hash_f32(
+    P: *const ClarabelCscMatrix<f32>,
+    A: *const ClarabelCscMatrix<f32>,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+) -> u64 {
+    _internal_structure_hash(_parts(&*P), _parts(&*A), n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_structure_hash_f64_i32(
+    P: *const ClarabelCscMatrix_i32<f64>,
+    A: *const ClarabelCscMatrix_i32<f64>,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f64>,
+) -> u64 {
+    _internal_structure_hash(_parts_i32(&*P), _parts_i32(&*A), n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_structure_hash_f32_i32(
+    P: *const ClarabelCscMatrix_i32<f32>,
+    A: *const ClarabelCscMatrix_i32<f32>,
+    n_cones: usize,
+    cones: *const ClarabelSupportedConeT<f32>,
+) -> u64 {
+    _internal_structure_hash(_parts_i32(&*P), _parts_i32(&*A), n_cones, cones)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f64_same_pattern(
+    A: *const ClarabelCscMatrix<f64>,
+    B: *const ClarabelCscMatrix<f64>,
+) -> bool {
+    _internal_CscMatrix_same_pattern(_parts(&*A), _parts(&*B))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f32_same_pattern(
+    A: *const ClarabelCscMatrix<f32>,
+    B: *const ClarabelCscMatrix<f32>,
+) -> bool {
+    _internal_CscMatrix_same_pattern(_parts(&*A), _parts(&*B))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f64_i32_same_pattern(
+    A: *const ClarabelCscMatrix_i32<f64>,
+    B: *const ClarabelCscMatrix_i32<f64>,
+) -> bool {
+    _internal_CscMatrix_same_pattern(_parts_i32(&*A), _parts_i32(&*B))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn clarabel_CscMatrix_f32_i32_same_pattern(
+    A: *const ClarabelCscMatrix_i32<f32>,
+    B: *const ClarabelCscMatrix_i32<f32>,
+) -> bool {
+    _internal_CscMatrix_same_pattern(_parts_i32(&*A), _parts_i32(&*B))
+}
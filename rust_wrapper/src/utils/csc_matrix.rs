@@ -1,4 +1,4 @@
-use crate::algebra::ClarabelCscMatrix;
+use crate::algebra::{ClarabelCscMatrix, ClarabelCscMatrix_i32};
 use clarabel::algebra as lib;
 use clarabel::algebra::FloatT;
 
@@ -43,3 +43,57 @@ pub unsafe fn convert_from_C_CscMatrix<T: FloatT>(ptr: *const ClarabelCscMatrix<
         nzval: nzval_vec,
     }
 }
+
+/// Convert a CscMatrix with 32-bit indices from C to Rust
+///
+/// The index arrays are widened into vectors owned by Rust, while the nzval vector takes
+/// ownership of the C array as in convert_from_C_CscMatrix.  Release the result with
+/// release_C_CscMatrix_i32 rather than std::mem::forget.
+#[allow(non_snake_case)]
+pub unsafe fn convert_from_C_CscMatrix_i32<T: FloatT>(ptr: *const ClarabelCscMatrix_i32<T>) -> lib::CscMatrix<T> {
+    // Recover the CscMatrix from the raw pointer from C
+    let matrix = match ptr.as_ref() {
+        Some(mat) => mat,
+        None => panic!("Null pointer passed to convert_from_C_CscMatrix_i32"),
+    };
+
+    let m = matrix.m;
+    let n = matrix.n;
+
+    let widen = |idx: &[i32]| -> Vec<usize> {
+        debug_assert!(idx.iter().all(|&i| i >= 0), "CSC indices must be nonnegative");
+        idx.iter().map(|&i| i as usize).collect()
+    };
+
+    // Length of colptr is always n + 1
+    let colptr = widen(std::slice::from_raw_parts(matrix.colptr, n + 1));
+    let nnz = colptr[n];
+
+    // Length of rowval and nzval is given by colptr[n]
+    let rowval = match matrix.rowval.is_null() {
+        true => Vec::new(),
+        false => widen(std::slice::from_raw_parts(matrix.rowval, nnz)),
+    };
+    let nzval_vec = match matrix.nzval.is_null() {
+        true => Vec::new(),
+        false => Vec::from_raw_parts(matrix.nzval as *mut T, nnz, nnz),
+    };
+
+    assert!(rowval.len() == nnz);
+
+    lib::CscMatrix::<T> {
+        m,
+        n,
+        colptr,
+        rowval,
+        nzval: nzval_vec,
+    }
+}
+
+/// Release a matrix returned by convert_from_C_CscMatrix_i32
+///
+/// Frees the widened index arrays and leaves the values to the C side.
+#[allow(non_snake_case)]
+pub fn release_C_CscMatrix_i32<T: FloatT>(matrix: lib::CscMatrix<T>) {
+    std::mem::forget(matrix.nzval);
+}
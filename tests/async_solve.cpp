@@ -0,0 +1,174 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "qp_fixture.hpp"
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+class AsyncSolveTest : public QPTest
+{
+  protected:
+    AsyncSolveTest()
+    {
+        settings.verbose = false;
+    }
+};
+
+TEST_F(AsyncSolveTest, ManyOverlappingSolves)
+{
+    const size_t n_problems = 100;
+
+    vector<DefaultSolver<double>> solvers;
+    solvers.reserve(n_problems);
+    for (size_t k = 0; k < n_problems; ++k)
+    {
+        solvers.emplace_back(P, c, A, b, cones, settings);
+    }
+
+    vector<future<DefaultInfo<double>>> results;
+    for (auto &solver : solvers)
+    {
+        results.push_back(solver.solve_async());
+    }
+
+    Vector2d ref_solution{ 0.3, 0.7 };
+    for (size_t k = 0; k < n_problems; ++k)
+    {
+        DefaultInfo<double> info = results[k].get();
+        ASSERT_EQ(info.status, SolverStatus::Solved);
+        ASSERT_TRUE(solvers[k].solution().x.isApprox(ref_solution, 1e-6));
+    }
+}
+
+TEST_F(AsyncSolveTest, CancelThroughTerminationCallback)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+
+    atomic<bool> cancelled(true);
+    solver.set_termination_callback(
+        [](DefaultInfo<double> &, void *userdata) -> int {
+            return static_cast<atomic<bool> *>(userdata)->load() ? 1 : 0;
+        },
+        &cancelled);
+
+    DefaultInfo<double> info = solver.solve_async().get();
+    ASSERT_EQ(info.status, SolverStatus::CallbackTerminated);
+
+    // and the solver can be solved again once the future is ready
+    cancelled = false;
+    info = solver.solve_async().get();
+    ASSERT_EQ(info.status, SolverStatus::Solved);
+}
+
+TEST_F(AsyncSolveTest, CancelToken)
+{
+    DefaultSolver<double> solver1(P, c, A, b, cones, settings);
+    DefaultSolver<double> solver2(P, c, A, b, cones, settings);
+
+    // one token shared by both solvers, and outliving its owner
+    {
+        CancelToken token;
+        solver1.set_cancel_token(token);
+        solver2.set_cancel_token(token);
+        token.cancel();
+        ASSERT_TRUE(token.cancelled());
+    }
+    ASSERT_EQ(solver1.solve_async().get().status, SolverStatus::CallbackTerminated);
+    solver2.solve();
+    ASSERT_EQ(solver2.info().status, SolverStatus::CallbackTerminated);
+
+    // a deadline in the past stops the solve, a distant one does not
+    CancelToken token;
+    solver1.set_cancel_token(token);
+    token.set_deadline(0.);
+    ASSERT_EQ(solver1.solve_async().get().status, SolverStatus::CallbackTerminated);
+
+    token.set_deadline(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    ASSERT_FALSE(token.cancelled());
+    ASSERT_EQ(solver1.solve_async().get().status, SolverStatus::Solved);
+
+    token.reset();
+    token.cancel();
+    solver1.unset_cancel_token();
+    ASSERT_EQ(solver1.solve_async().get().status, SolverStatus::Solved);
+}
+
+TEST_F(AsyncSolveTest, ReadIterationRingDuringSolve)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+
+    vector<IterationRecord<double>> records(100);
+    IterationRing<double> ring = { records.data(), records.size(), 0 };
+    solver.set_iteration_observer(ring);
+
+    // head only grows, and every record below it is complete
+    future<DefaultInfo<double>> result = solver.solve_async();
+    uint64_t seen = 0;
+    while (result.wait_for(chrono::milliseconds(0)) != future_status::ready)
+    {
+        uint64_t head = ring.load_head();
+        ASSERT_GE(head, seen);
+        for (uint64_t k = 1; k < head; ++k)
+        {
+            ASSERT_EQ(records[k].iteration, records[0].iteration + k);
+        }
+        seen = head;
+    }
+    DefaultInfo<double> info = result.get();
+    ASSERT_EQ(info.status, SolverStatus::Solved);
+    ASSERT_GE(ring.load_head(), info.iterations);
+}
+
+// Restores the process-wide thread settings to their defaults, also when an assertion fails
+struct ThreadSettingsGuard
+{
+    uint32_t budget = solver_thread_budget();
+    ~ThreadSettingsGuard()
+    {
+        set_global_thread_pool(0);
+        set_solver_thread_budget(budget);
+    }
+};
+
+TEST_F(AsyncSolveTest, GlobalThreadPool)
+{
+    ThreadSettingsGuard guard;
+    set_global_thread_pool(2);
+    ASSERT_EQ(global_thread_pool(), 2u);
+    set_solver_thread_budget(1);
+    ASSERT_EQ(solver_thread_budget(), 1u);
+
+    vector<DefaultSolver<double>> solvers;
+    for (size_t k = 0; k < 20; ++k)
+    {
+        solvers.emplace_back(P, c, A, b, cones, settings);
+    }
+    vector<future<DefaultInfo<double>>> results;
+    for (auto &solver : solvers)
+    {
+        results.push_back(solver.solve_async());
+    }
+    for (auto &result : results)
+    {
+        ASSERT_EQ(result.get().status, SolverStatus::Solved);
+    }
+
+    // batch solves default to the global thread count
+    BatchSolver<double> batch;
+    vector<DefaultInfo<double>> infos = batch.solve(solvers);
+    for (const auto &info : infos)
+    {
+        ASSERT_EQ(info.status, SolverStatus::Solved);
+    }
+
+    set_global_thread_pool(0);
+    ASSERT_GE(global_thread_pool(), 1u);
+}
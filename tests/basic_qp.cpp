@@ -6,41 +6,14 @@
 #include <limits>
 #include <vector>
 
+#include "qp_fixture.hpp"
+
 using namespace std;
 using namespace clarabel;
 using namespace Eigen;
 
-class BasicQPTest : public ::testing::Test
+class BasicQPTest : public QPTest
 {
-  protected:
-    SparseMatrix<double> P, A;
-    Vector<double, 2> c = { 1., 1. };
-    Vector<double, 6> b = { -1., 0., 0., 1., 0.7, 0.7 };
-    vector<SupportedConeT<double>> cones = {
-        NonnegativeConeT<double>(3),
-        NonnegativeConeT<double>(3)
-    };
-    DefaultSettings<double> settings = DefaultSettings<double>::default_settings();
-
-    BasicQPTest()
-    {
-        MatrixXd P_dense(2, 2);
-        P_dense << 4., 1.,
-            1., 2.;
-        P = P_dense.sparseView();
-        P.makeCompressed();
-
-        MatrixXd A_dense(6, 2);
-        A_dense <<
-            -1., -1.,
-            -1., 0.,
-            0., -1.,
-            1., 1.,
-            1., 0.,
-            0., 1.;
-        A = A_dense.sparseView();
-        A.makeCompressed();
-    }
 };
 
 TEST_F(BasicQPTest, Univariate)
@@ -89,6 +62,211 @@ TEST_F(BasicQPTest, Feasible)
     ASSERT_NEAR(solution.obj_val_dual, ref_obj, 1e-6);
 }
 
+TEST_F(BasicQPTest, SolutionInto)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+    solver.solve();
+
+    DefaultSolution<double> solution = solver.solution();
+    ASSERT_EQ(solution.status, SolverStatus::Solved);
+
+    // copy all vectors into caller-owned storage
+    VectorXd x(2), z(6), s(6);
+    solver.solution_into(x, z, s);
+    ASSERT_TRUE(x.isApprox(solution.x, 1e-12));
+    ASSERT_TRUE(z.isApprox(solution.z, 1e-12));
+    ASSERT_TRUE(s.isApprox(solution.s, 1e-12));
+
+    // primal solution only
+    VectorXd x_only = VectorXd::Zero(2);
+    solver.solution_into(x_only);
+    ASSERT_TRUE(x_only.isApprox(solution.x, 1e-12));
+
+    // buffers of the wrong length are rejected without writing
+    VectorXd x_short = VectorXd::Zero(1), z_short = VectorXd::Zero(2);
+    ASSERT_THROW(solver.solution_into(x_short), invalid_argument);
+    ASSERT_THROW(solver.solution_into(x, z_short, s), invalid_argument);
+    ASSERT_THROW(solver.solution_into(x, z, z_short), invalid_argument);
+    ASSERT_EQ(x_short[0], 0.);
+}
+
+TEST_F(BasicQPTest, SolveKkt)
+{
+    auto solver = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings);
+
+    MatrixXd rhs = MatrixXd::Zero(8, 2), out;
+    ASSERT_THROW(solver.solve_kkt(rhs, out), runtime_error);
+
+    solver.solve();
+    VectorXd x = solver.solution().x;
+
+    // directions: increase q[0], and increase b[0]
+    rhs(0, 0) = -1.;
+    rhs(2, 1) = 1.;
+    solver.solve_kkt(rhs, out);
+    ASSERT_EQ(out.rows(), 8);
+    ASSERT_EQ(out.cols(), 2);
+
+    // compare with finite differences
+    const double h = 1e-4;
+    Vector<double, 2> c_h = c;
+    c_h[0] += h;
+    DefaultSolver<double> solver_q(P, c_h, A, b, cones, settings);
+    solver_q.solve();
+    VectorXd dx_q = (solver_q.solution().x - x) / h;
+    ASSERT_TRUE((out.col(0).head(2) - dx_q).norm() < 1e-3);
+
+    Vector<double, 6> b_h = b;
+    b_h[0] += h;
+    DefaultSolver<double> solver_b(P, c, A, b_h, cones, settings);
+    solver_b.solve();
+    VectorXd dx_b = (solver_b.solution().x - x) / h;
+    ASSERT_TRUE((out.col(1).head(2) - dx_b).norm() < 1e-3);
+
+    // wrong number of rows
+    MatrixXd short_rhs = MatrixXd::Zero(2, 1);
+    ASSERT_THROW(solver.solve_kkt(short_rhs, out), runtime_error);
+
+    // the cached factors are dropped by a data update and a new solve
+    MatrixXd out_cached;
+    solver.solve_kkt(rhs, out_cached);
+    ASSERT_TRUE(out_cached.isApprox(out, 1e-12));
+
+    // the solution no longer belongs to the data until the next solve
+    solver.update_q(c_h);
+    ASSERT_THROW(solver.solve_kkt(rhs, out_cached), runtime_error);
+    solver.solve();
+    auto solver_fresh = DefaultSolver<double>::with_problem_data(P, c_h, A, b, cones, settings);
+    solver_fresh.solve();
+    MatrixXd out_updated, out_fresh;
+    solver.solve_kkt(rhs, out_updated);
+    solver_fresh.solve_kkt(rhs, out_fresh);
+    ASSERT_TRUE(out_updated.isApprox(out_fresh, 1e-8));
+
+    // only solutions that are optimal or nearly so have a meaningful KKT system
+    DefaultSettings<double> settings_short = settings;
+    settings_short.max_iter = 1;
+    auto solver_short = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings_short);
+    solver_short.solve();
+    ASSERT_EQ(solver_short.solution().status, SolverStatus::MaxIterations);
+    ASSERT_THROW(solver_short.solve_kkt(rhs, out), runtime_error);
+}
+
+TEST_F(BasicQPTest, Backward)
+{
+    auto solver = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings);
+    solver.solve();
+
+    // loss: x[0] + 2 x[1]
+    VectorXd dx(2), dz = VectorXd::Zero(6), ds = VectorXd::Zero(6);
+    dx << 1., 2.;
+    VectorXd dP(P.nonZeros()), dq(2), dA(A.nonZeros()), db(6);
+    solver.backward(dx, dz, ds, dP, dq, dA, db);
+
+    auto loss = [&](const SparseMatrix<double> &P_h, Vector<double, 2> c_h, const SparseMatrix<double> &A_h,
+                    Vector<double, 6> b_h) {
+        DefaultSolver<double> perturbed(P_h, c_h, A_h, b_h, cones, settings);
+        perturbed.solve();
+        VectorXd x = perturbed.solution().x;
+        return x[0] + 2. * x[1];
+    };
+    const double h = 1e-4;
+    const double L = loss(P, c, A, b);
+
+    Vector<double, 2> c_h = c;
+    c_h[1] += h;
+    ASSERT_NEAR(dq[1], (loss(P, c_h, A, b) - L) / h, 1e-3);
+
+    Vector<double, 6> b_h = b;
+    b_h[5] += h;
+    ASSERT_NEAR(db[5], (loss(P, c, A, b_h) - L) / h, 1e-3);
+
+    SparseMatrix<double> P_h = P;
+    P_h.valuePtr()[0] += h;
+    ASSERT_NEAR(dP[0], (loss(P_h, c, A, b) - L) / h, 1e-3);
+
+    // P is stored in full.  The off-diagonal entry above the diagonal at valuePtr()[2] sets both
+    // symmetric positions, and the one below it is not used by the solver.
+    ASSERT_EQ(P.innerIndexPtr()[2], 0);
+    SparseMatrix<double> P_upper = P;
+    P_upper.valuePtr()[2] += h;
+    ASSERT_NEAR(dP[2], (loss(P_upper, c, A, b) - L) / h, 1e-3);
+    ASSERT_EQ(dP[1], 0.);
+
+    SparseMatrix<double> A_h = A;
+    A_h.valuePtr()[0] += h;
+    ASSERT_NEAR(dA[0], (loss(P, c, A_h, b) - L) / h, 1e-3);
+
+    VectorXd short_db(2);
+    ASSERT_THROW(solver.backward(dx, dz, ds, dP, dq, dA, short_db), invalid_argument);
+
+    // backward reuses the factors of solve_kkt and requires an optimal solution
+    MatrixXd rhs = MatrixXd::Zero(8, 1), out;
+    solver.solve_kkt(rhs, out);
+    VectorXd dq_again(2);
+    solver.backward(dx, dz, ds, dP, dq_again, dA, db);
+    ASSERT_TRUE(dq_again.isApprox(dq, 1e-12));
+
+    DefaultSettings<double> settings_short = settings;
+    settings_short.max_iter = 1;
+    auto solver_short = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings_short);
+    solver_short.solve();
+    ASSERT_THROW(solver_short.backward(dx, dz, ds, dP, dq, dA, db), runtime_error);
+}
+
+TEST_F(BasicQPTest, SettingsHandle)
+{
+    DefaultSolver<double> solver1(P, c, A, b, cones, settings);
+    solver1.solve();
+
+    // one handle shared by several solvers
+    DefaultSettingsHandle<double> handle(settings);
+    for (int k = 0; k < 3; ++k)
+    {
+        DefaultSolver<double> solver2(P, c, A, b, cones, handle);
+        solver2.solve();
+
+        DefaultSolution<double> solution = solver2.solution();
+        ASSERT_EQ(solution.status, SolverStatus::Solved);
+        ASSERT_TRUE(solution.x.isApprox(solver1.solution().x, 1e-12));
+    }
+}
+
+static void append_output(const char *data, uintptr_t len, void *userdata)
+{
+    static_cast<string *>(userdata)->append(data, len);
+}
+
+TEST_F(BasicQPTest, PrintToFixedBufferAndCallback)
+{
+    settings.verbose = true;
+
+    // full log into a buffer large enough to hold it
+    vector<char> buffer(1 << 16);
+    DefaultSolver<double> solver1(P, c, A, b, cones, settings);
+    solver1.print_to_fixed_buffer(buffer.data(), buffer.size());
+    solver1.solve();
+    uintptr_t len = solver1.fixed_buffer_len();
+    ASSERT_GT(len, 0u);
+    ASSERT_LT(len, buffer.size());
+
+    // the same log through a callback
+    string output;
+    DefaultSolver<double> solver2(P, c, A, b, cones, settings);
+    solver2.print_to_callback(append_output, &output);
+    solver2.solve();
+    ASSERT_FALSE(output.empty());
+    ASSERT_EQ(output.substr(0, 64), string(buffer.data(), 64));
+
+    // a small buffer is truncated without overflowing
+    vector<char> small(17, 'x');
+    DefaultSolver<double> solver3(P, c, A, b, cones, settings);
+    solver3.print_to_fixed_buffer(small.data(), 16);
+    solver3.solve();
+    ASSERT_EQ(solver3.fixed_buffer_len(), 16u);
+    ASSERT_EQ(small[16], 'x');
+}
+
 TEST_F(BasicQPTest, PrimalInfeasible)
 {
     b[0] = -1.;
@@ -0,0 +1,76 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "qp_fixture.hpp"
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+class BatchSolveTest : public QPTest
+{
+  protected:
+    BatchSolveTest()
+    {
+        settings.verbose = false;
+    }
+};
+
+TEST_F(BatchSolveTest, ReplicatedQP)
+{
+    const size_t n_problems = 1000;
+
+    vector<DefaultSolver<double>> solvers;
+    solvers.reserve(n_problems);
+    for (size_t k = 0; k < n_problems; ++k)
+    {
+        solvers.emplace_back(P, c, A, b, cones, settings);
+    }
+
+    BatchSolver<double> batch(4);
+    vector<DefaultInfo<double>> info = batch.solve(solvers);
+    ASSERT_EQ(info.size(), n_problems);
+
+    Vector2d ref_solution{ 0.3, 0.7 };
+    for (size_t k = 0; k < n_problems; ++k)
+    {
+        ASSERT_EQ(info[k].status, SolverStatus::Solved);
+        ASSERT_TRUE(solvers[k].solution().x.isApprox(ref_solution, 1e-6));
+    }
+}
+
+TEST_F(BatchSolveTest, MatchesSerialSolve)
+{
+    // Different linear costs so that each problem has its own solution
+    vector<DefaultSolver<double>> batch_solvers;
+    vector<DefaultSolver<double> *> batch_ptrs;
+    batch_solvers.reserve(16);
+    for (int k = 0; k < 16; ++k)
+    {
+        Vector<double, 2> ck = { 1. + 0.1 * k, 1. - 0.05 * k };
+        batch_solvers.emplace_back(P, ck, A, b, cones, settings);
+    }
+    for (auto &solver : batch_solvers)
+    {
+        batch_ptrs.push_back(&solver);
+    }
+
+    // all available cores
+    BatchSolver<double> batch;
+    vector<DefaultInfo<double>> info = batch.solve(batch_ptrs);
+
+    for (int k = 0; k < 16; ++k)
+    {
+        Vector<double, 2> ck = { 1. + 0.1 * k, 1. - 0.05 * k };
+        DefaultSolver<double> serial(P, ck, A, b, cones, settings);
+        serial.solve();
+
+        ASSERT_EQ(info[k].status, serial.info().status);
+        ASSERT_EQ(info[k].iterations, serial.info().iterations);
+        auto diff = batch_solvers[k].solution().x - serial.solution().x;
+        ASSERT_NEAR(diff.norm(), 0.0, 1e-10);
+    }
+}
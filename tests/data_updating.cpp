@@ -154,6 +154,46 @@ TEST_F(DataUpdatingTest, update_P_partial_eigen)
     ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
 }
 
+TEST_F(DataUpdatingTest, update_sorted)
+{
+    DefaultSolver<double> solver1(P, q, A, b, cones, settings);
+    solver1.solve();
+
+    // a few entries of P with 32-bit indices, and all of b
+    Vector<int32_t, 2> P_index = { 1, 2 };
+    Vector<double, 2> P_values = { 3., 5. };
+    solver1.update_P_sorted(P_index, P_values);
+
+    Vector<uintptr_t, 4> b_index = { 0, 1, 2, 3 };
+    Vector<double, 4> b_values = { 2., 1., 2., 1. };
+    solver1.update_b_sorted(b_index.data(), b_values.data(), b_index.size());
+    solver1.solve();
+
+    //new solver
+    SparseMatrix<double> P2 = P;
+    P2.valuePtr()[1] = 3.;
+    P2.valuePtr()[2] = 5.;
+    DefaultSolver<double> solver2(P2, q, A, b_values, cones, settings);
+    solver2.solve();
+
+    auto diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+
+    // unsorted, repeated and out of range indices are rejected
+    Vector<int32_t, 2> unsorted = { 2, 1 };
+    Vector<int32_t, 2> repeated = { 1, 1 };
+    Vector<int32_t, 2> out_of_range = { 1, 3 };
+    ASSERT_THROW(solver1.update_P_sorted(unsorted, P_values), std::invalid_argument);
+    ASSERT_THROW(solver1.update_P_sorted(repeated, P_values), std::invalid_argument);
+    ASSERT_THROW(solver1.update_P_sorted(out_of_range, P_values), std::invalid_argument);
+    uintptr_t b_out_of_range = 4;
+    ASSERT_THROW(solver1.update_b_sorted(&b_out_of_range, b_values.data(), 1), std::invalid_argument);
+
+    // also when checked against the copy of the problem data
+    auto solver3 = DefaultSolver<double>::with_problem_data(P, q, A, b, cones, settings);
+    ASSERT_THROW(solver3.update_P_sorted(out_of_range, P_values), std::invalid_argument);
+}
+
 TEST_F(DataUpdatingTest, update_A_csc)
 {
     DefaultSolver<double> solver1(P, q, A, b, cones, settings);
@@ -451,3 +491,176 @@ TEST_F(DataUpdatingTest, update_b_partial_eigen)
 
 
 
+
+TEST_F(DataUpdatingTest, update_data)
+{
+    DefaultSolver<double> solver1(P, q, A, b, cones, settings);
+    solver1.solve();
+
+    // change every field and re-solve
+    SparseMatrix<double> P2 = P;
+    P2.valuePtr()[0] = 100.;
+    SparseMatrix<double> A2 = A;
+    A2.valuePtr()[1] = -2.;
+    Vector<double, 2> q2 = { 0., 1. };
+    Vector<double, 4> b2 = { 2., 1., 2., 1. };
+
+    VectorXd Pnzval = Map<VectorXd>(P2.valuePtr(), P2.nonZeros());
+    VectorXd Anzval = Map<VectorXd>(A2.valuePtr(), A2.nonZeros());
+    solver1.update_data(Pnzval, q2, Anzval, b2);
+    solver1.solve();
+    ASSERT_EQ(solver1.timings().update_count, 1);
+
+    DefaultSolver<double> solver2(P2, q2, A2, b2, cones, settings);
+    solver2.solve();
+    VectorXd diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+
+    // empty vectors leave their fields unchanged
+    Vector<double, 4> b3 = { 1., 1., 1., 1. };
+    VectorXd unchanged;
+    solver1.update_data(unchanged, unchanged, unchanged, b3);
+    solver1.solve();
+
+    DefaultSolver<double> solver3(P2, q2, A2, b3, cones, settings);
+    solver3.solve();
+    diff = solver1.solution().x - solver3.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+}
+
+TEST_F(DataUpdatingTest, pattern_locked)
+{
+    DefaultSolver<double> solver1(P, q, A, b, cones, settings);
+    solver1.set_pattern_locked(true);
+    ASSERT_TRUE(solver1.pattern_locked());
+    solver1.solve();
+    ASSERT_EQ(solver1.timings().symbolic_count, 1u);
+
+    // same pattern, new values: no new symbolic analysis
+    SparseMatrix<double> P2 = P;
+    P2.valuePtr()[0] = 100.;
+    solver1.update_P(P2);
+    solver1.update_q(q);
+    solver1.solve();
+    ASSERT_EQ(solver1.timings().symbolic_count, 1u);
+
+    DefaultSolver<double> solver2(P2, q, A, b, cones, settings);
+    solver2.solve();
+    auto diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+
+    // a different pattern is rejected
+    SparseMatrix<double> P3 = P;
+    P3.insert(1, 0) = 1.;
+    P3.makeCompressed();
+    ASSERT_THROW(solver1.update_P(P3), std::invalid_argument);
+
+    SparseMatrix<double> A3 = A;
+    A3.insert(0, 1) = 1.;
+    A3.makeCompressed();
+    ASSERT_THROW(solver1.update_A(A3), std::invalid_argument);
+
+    // a different pattern with the same number of nonzeros is rejected while locked,
+    // and by the solver's own check once unlocked
+    MatrixXd A4_dense(4, 2);
+    A4_dense <<
+        -1., 0.,
+        0., -1.,
+        0., 0.,
+        1., 1.;
+    SparseMatrix<double> A4 = A4_dense.sparseView();
+    A4.makeCompressed();
+    ASSERT_EQ(A4.nonZeros(), A.nonZeros());
+    ASSERT_THROW(solver1.update_A(A4), std::invalid_argument);
+
+    solver1.set_pattern_locked(false);
+    ASSERT_THROW(solver1.update_A(A4), std::invalid_argument);
+    ASSERT_NO_THROW(solver1.update_A(A));
+    ASSERT_EQ(solver1.timings().symbolic_count, 1u);
+
+    // rebuilding runs the analysis again, and a clone counts the analyses of its original
+    auto kept = DefaultSolver<double>::with_problem_data(P, q, A, b, cones, settings);
+    kept.update_P(P2);
+    kept.solve();
+    ASSERT_EQ(kept.timings().symbolic_count, 1u);
+    DefaultSolver<double> rebuilt = kept.clone();
+    ASSERT_EQ(rebuilt.timings().symbolic_count, 2u);
+    rebuilt.solve();
+    ASSERT_EQ(rebuilt.timings().symbolic_count, 2u);
+    ASSERT_EQ(kept.timings().symbolic_count, 1u);
+}
+
+TEST_F(DataUpdatingTest, update_same_matrix_in_place)
+{
+    DefaultSolver<double> solver1(P, q, A, b, cones, settings);
+    solver1.solve();
+
+    // the matrices the solver was built from, with new values written in place
+    for (int k = 1; k <= 3; ++k)
+    {
+        P.valuePtr()[0] = 4. * k;
+        A.valuePtr()[0] = -1. * k;
+        solver1.update_P(P);
+        solver1.update_A(A);
+        solver1.solve();
+
+        DefaultSolver<double> solver2(P, q, A, b, cones, settings);
+        solver2.solve();
+        auto diff = solver1.solution().x - solver2.solution().x;
+        ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+    }
+
+    // a copy of the matrix has other index storage and takes the checked path
+    SparseMatrix<double> A_copy = A;
+    A_copy.innerIndexPtr()[1] = 3;
+    ASSERT_THROW(solver1.update_A(A_copy), std::invalid_argument);
+
+    // with the pattern locked, row indices rewritten in place in the same buffers are checked too
+    solver1.set_pattern_locked(true);
+    const int *inner = A.innerIndexPtr();
+    A.innerIndexPtr()[1] = 3;
+    ASSERT_THROW(solver1.update_A(A), std::invalid_argument);
+    A.innerIndexPtr()[1] = 2;
+    ASSERT_EQ(A.innerIndexPtr(), inner);
+    ASSERT_NO_THROW(solver1.update_A(A));
+
+    // as is a changed pattern in the same object
+    P.insert(1, 0) = 1.;
+    P.makeCompressed();
+    ASSERT_THROW(solver1.update_P(P), std::invalid_argument);
+}
+
+TEST_F(DataUpdatingTest, clone)
+{
+    // solvers keep no copy of the problem data unless asked to
+    DefaultSolver<double> plain(P, q, A, b, cones, settings);
+    ASSERT_THROW(plain.clone(), std::runtime_error);
+
+    auto solver1 = DefaultSolver<double>::with_problem_data(P, q, A, b, cones, settings);
+
+    // updates made before cloning are carried over
+    Vector<double,4> b2 = { 2., 1., 2., 1. };
+    solver1.update_b(b2);
+    solver1.solve();
+
+    DefaultSolver<double> solver2 = solver1.clone();
+    solver2.solve();
+    VectorXd diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-8);
+
+    // and the clone is independent of the original
+    Vector<double,2> q2 = { 10., -10. };
+    solver2.update_q(q2);
+    solver2.solve();
+
+    DefaultSolver<double> solver3(P, q2, A, b2, cones, settings);
+    solver3.solve();
+    diff = solver2.solution().x - solver3.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+
+    solver1.solve();
+    DefaultSolver<double> solver4(P, q, A, b2, cones, settings);
+    solver4.solve();
+    diff = solver1.solution().x - solver4.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+}
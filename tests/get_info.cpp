@@ -59,4 +59,87 @@ TEST_F(GetInfoTest, Feasible)
     ASSERT_EQ(info.linsolver.direct, true);
     ASSERT_EQ(info.linsolver.nnzA, 17);
     ASSERT_EQ(info.linsolver.nnzL, 9);
-}
\ No newline at end of file
+}
+
+TEST_F(GetInfoTest, Timings)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+
+    auto timings = solver.timings();
+    ASSERT_GT(timings.setup_time, 0.0);
+    ASSERT_EQ(timings.solve_count, 0);
+    ASSERT_EQ(timings.update_count, 0);
+
+    solver.solve();
+    solver.update_q(c);
+    solver.solve();
+
+    timings = solver.timings();
+    ASSERT_EQ(timings.solve_count, 2);
+    ASSERT_EQ(timings.update_count, 1);
+    ASSERT_EQ(timings.iterations, 2 * solver.info().iterations);
+    ASSERT_GE(timings.solve_time, timings.last_solve_time);
+    ASSERT_GT(timings.last_solve_time, 0.0);
+
+    solver.reset_timings();
+    timings = solver.timings();
+    ASSERT_GT(timings.setup_time, 0.0);
+    ASSERT_EQ(timings.solve_count, 0);
+    ASSERT_EQ(timings.iterations, 0);
+    ASSERT_EQ(timings.solve_time, 0.0);
+}
+
+TEST_F(GetInfoTest, IterationObserver)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+
+    vector<IterationRecord<double>> records(100);
+    IterationRing<double> ring = { records.data(), records.size(), 0 };
+    solver.set_iteration_observer(ring);
+    solver.solve();
+
+    DefaultInfo<double> info = solver.info();
+    ASSERT_EQ(solver.solution().status, SolverStatus::Solved);
+    ASSERT_EQ(ring.load_head(), ring.head);
+    ASSERT_GE(ring.head, info.iterations);
+    ASSERT_LE(ring.head, info.iterations + 1);
+
+    for (uint64_t k = 1; k < ring.head; ++k)
+    {
+        ASSERT_EQ(records[k].iteration, records[k - 1].iteration + 1);
+        ASSERT_GE(records[k].elapsed, records[k - 1].elapsed);
+    }
+    const IterationRecord<double> &last = records[ring.head - 1];
+    ASSERT_LE(last.iteration, info.iterations);
+    ASSERT_GE(last.iteration + 1, info.iterations);
+    ASSERT_GT(last.elapsed, 0.0);
+
+    // a small ring wraps around and keeps the most recent records
+    vector<IterationRecord<double>> small(3);
+    IterationRing<double> small_ring = { small.data(), small.size(), 0 };
+    solver.set_iteration_observer(small_ring);
+    solver.solve();
+    ASSERT_EQ(small_ring.head, ring.head);
+    ASSERT_EQ(small[(small_ring.head - 1) % 3].iteration, last.iteration);
+
+    // detached observers receive nothing
+    solver.unset_iteration_observer();
+    solver.solve();
+    ASSERT_EQ(small_ring.head, ring.head);
+}
+
+TEST_F(GetInfoTest, IterationObserverWithTermination)
+{
+    DefaultSolver<double> solver(P, c, A, b, cones, settings);
+
+    vector<IterationRecord<double>> records(100);
+    IterationRing<double> ring = { records.data(), records.size(), 0 };
+    solver.set_iteration_observer(ring);
+    solver.set_termination_callback(
+        [](DefaultInfo<double> &info, void *) -> int { return info.iterations >= 2 ? 1 : 0; }, nullptr);
+    solver.solve();
+
+    ASSERT_EQ(solver.solution().status, SolverStatus::CallbackTerminated);
+    ASSERT_GT(ring.head, 0u);
+    ASSERT_GE(records[ring.head - 1].iteration, 2u);
+}
@@ -0,0 +1,106 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+class LdlSolverTest : public ::testing::Test
+{
+  protected:
+    // quasidefinite: positive definite leading block, negative definite trailing block
+    MatrixXd K_dense;
+    SparseMatrix<double> K_upper;
+    vector<int8_t> Dsigns = { 1, 1, -1 };
+
+    LdlSolverTest() : K_dense(3, 3)
+    {
+        K_dense <<
+            4., 1., 0.,
+            1., 3., 1.,
+            0., 1., -2.;
+        MatrixXd upper = K_dense.triangularView<Upper>();
+        K_upper = upper.sparseView();
+        K_upper.makeCompressed();
+    }
+};
+
+TEST_F(LdlSolverTest, SolveMultipleRhs)
+{
+    LdlSolver<double> ldl(K_upper, Dsigns);
+    ASSERT_EQ(ldl.dim(), 3);
+    ASSERT_EQ(ldl.positive_inertia(), 2u);
+
+    MatrixXd B(3, 2);
+    B << 1., 0.,
+        2., 1.,
+        3., -1.;
+    MatrixXd X = B;
+    ldl.solve(X);
+    ASSERT_TRUE((K_dense * X).isApprox(B, 1e-10));
+
+    // a single right hand side
+    VectorXd x = B.col(0);
+    ldl.solve(x);
+    ASSERT_TRUE(x.isApprox(X.col(0), 1e-12));
+}
+
+TEST_F(LdlSolverTest, WithoutDsigns)
+{
+    // K is quasidefinite, so it factors without regularization
+    LdlSolver<double> ldl(K_upper);
+    ASSERT_EQ(ldl.positive_inertia(), 2u);
+
+    VectorXd b(3);
+    b << 1., 2., 3.;
+    VectorXd x = b;
+    ldl.solve(x);
+    ASSERT_TRUE((K_dense * x).isApprox(b, 1e-10));
+}
+
+TEST_F(LdlSolverTest, Refactor)
+{
+    LdlSolver<double> ldl(K_upper, Dsigns);
+
+    VectorXd b(3);
+    b << 1., 2., 3.;
+    VectorXd x1 = b;
+    ldl.solve(x1);
+
+    // doubling every value halves the solution
+    VectorXd nzval = Map<VectorXd>(K_upper.valuePtr(), K_upper.nonZeros()) * 2.;
+    ldl.refactor(nzval);
+    VectorXd x2 = b;
+    ldl.solve(x2);
+    ASSERT_TRUE(x2.isApprox(x1 / 2., 1e-10));
+
+    // change only the first diagonal entry
+    MatrixXd K2 = K_dense;
+    K2(0, 0) = 5.;
+    VectorXd value(1);
+    value << 5.;
+    ldl.refactor(Map<VectorXd>(K_upper.valuePtr(), K_upper.nonZeros()));
+    ldl.update_values({ 0 }, value);
+    ldl.refactor();
+    VectorXd x3 = b;
+    ldl.solve(x3);
+    ASSERT_TRUE((K2 * x3).isApprox(b, 1e-10));
+}
+
+TEST_F(LdlSolverTest, RejectsBadInput)
+{
+    SparseMatrix<double> rect(3, 2);
+    ASSERT_THROW(LdlSolver<double>{ rect }, invalid_argument);
+    ASSERT_THROW(LdlSolver<double>(K_upper, vector<int8_t>{ 1, 1 }), invalid_argument);
+    ASSERT_THROW(LdlSolver<double>(K_upper, vector<int8_t>{ 1, 0, -1 }), invalid_argument);
+    ASSERT_THROW(LdlSolver<double>(K_upper, vector<int8_t>{ 1, 2, -1 }), invalid_argument);
+
+    LdlSolver<double> ldl(K_upper, Dsigns);
+    MatrixXd B(2, 1);
+    ASSERT_THROW(ldl.solve(B), invalid_argument);
+    VectorXd short_values(2);
+    ASSERT_THROW(ldl.refactor(short_values), invalid_argument);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <gtest/gtest.h>
+#include <vector>
+
+// The two variable QP of basic_qp.cpp, for tests that need a small problem with a known solution.  The constraints
+// hold x[0] + x[1] at 1 through two inequalities and bound each variable to [0, 0.7].
+class QPTest : public ::testing::Test
+{
+  protected:
+    Eigen::SparseMatrix<double> P, A;
+    Eigen::Vector<double, 2> c = { 1., 1. };
+    Eigen::VectorXd b = (Eigen::VectorXd(6) << -1., 0., 0., 1., 0.7, 0.7).finished();
+    std::vector<clarabel::SupportedConeT<double>> cones = {
+        clarabel::NonnegativeConeT<double>(3),
+        clarabel::NonnegativeConeT<double>(3)
+    };
+    clarabel::DefaultSettings<double> settings = clarabel::DefaultSettings<double>::default_settings();
+
+    QPTest()
+    {
+        P = P_dense().sparseView();
+        P.makeCompressed();
+        A = A_dense().sparseView();
+        A.makeCompressed();
+    }
+
+    static Eigen::MatrixXd P_dense()
+    {
+        Eigen::MatrixXd P(2, 2);
+        P << 4., 1.,
+            1., 2.;
+        return P;
+    }
+
+    static Eigen::MatrixXd A_dense()
+    {
+        Eigen::MatrixXd A(6, 2);
+        A <<
+            -1., -1.,
+            -1., 0.,
+            0., -1.,
+            1., 1.,
+            1., 0.,
+            0., 1.;
+        return A;
+    }
+};
@@ -0,0 +1,133 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "qp_fixture.hpp"
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+// The shared QP with a second-order cone appended
+class SnapshotTest : public QPTest
+{
+  protected:
+    string filename = "clarabel_snapshot_test.bin";
+
+    SnapshotTest()
+    {
+        MatrixXd A_soc(9, 2);
+        A_soc <<
+            A_dense(),
+            0., 0.,
+            -1., 0.,
+            0., -1.;
+        A = A_soc.sparseView();
+        A.makeCompressed();
+        b.conservativeResize(9);
+        b.tail(3) << 1., 0., 0.;
+        cones = {
+            NonnegativeConeT<double>(6),
+            SecondOrderConeT<double>(3),
+        };
+
+        settings.verbose = false;
+        settings.max_iter = 40;
+    }
+
+    ~SnapshotTest() override { remove(filename.c_str()); }
+};
+
+TEST_F(SnapshotTest, RoundTrip)
+{
+    auto solver1 = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings);
+    solver1.solve();
+    ASSERT_EQ(solver1.solution().status, SolverStatus::Solved);
+    solver1.save_binary(filename);
+
+    DefaultSolver<double> solver2 = DefaultSolver<double>::load_binary(filename);
+    ASSERT_EQ(solver2.timings().symbolic_count, 1u);
+    solver2.solve();
+
+    ASSERT_EQ(solver2.solution().status, SolverStatus::Solved);
+    ASSERT_EQ(solver1.info().iterations, solver2.info().iterations);
+    ASSERT_TRUE(solver2.solution().x.isApprox(solver1.solution().x, 1e-12));
+}
+
+TEST_F(SnapshotTest, UpdatedDataAndSettings)
+{
+    // the snapshot holds the current data, not the data at construction
+    auto solver1 = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings);
+    Vector<double, 2> c2 = { 2., 1. };
+    solver1.update_q(c2);
+    solver1.solve();
+    solver1.save_binary(filename);
+
+    DefaultSolver<double> solver2(P, c2, A, b, cones, settings);
+    solver2.solve();
+
+    DefaultSolver<double> solver3 = DefaultSolver<double>::load_binary(filename);
+    solver3.solve();
+    ASSERT_TRUE(solver3.solution().x.isApprox(solver2.solution().x, 1e-12));
+
+    // explicit settings replace the stored ones
+    DefaultSettings<double> settings2 = settings;
+    settings2.max_iter = 1;
+    DefaultSolver<double> solver4 = DefaultSolver<double>::load_binary(filename, settings2);
+    solver4.solve();
+    ASSERT_EQ(solver4.solution().status, SolverStatus::MaxIterations);
+}
+
+TEST_F(SnapshotTest, InvalidFile)
+{
+    ASSERT_THROW(DefaultSolver<double>::load_binary("clarabel_snapshot_missing.bin"), std::runtime_error);
+
+    FILE *file = fopen(filename.c_str(), "wb");
+    fputs("{\"P\": []}", file);
+    fclose(file);
+    ASSERT_THROW(DefaultSolver<double>::load_binary(filename), std::runtime_error);
+}
+
+TEST_F(SnapshotTest, CorruptedSettings)
+{
+    auto solver = DefaultSolver<double>::with_problem_data(P, c, A, b, cones, settings);
+    solver.save_binary(filename);
+
+    // overwrite one byte of a copy of the snapshot and try to load it
+    auto load_with = [&](long offset, unsigned char value) {
+        FILE *file = fopen(filename.c_str(), "r+b");
+        fseek(file, offset, SEEK_SET);
+        int old = fgetc(file);
+        fseek(file, offset, SEEK_SET);
+        fputc(value, file);
+        fclose(file);
+        bool ok = true;
+        try
+        {
+            DefaultSolver<double>::load_binary(filename);
+        }
+        catch (const std::runtime_error &)
+        {
+            ok = false;
+        }
+        file = fopen(filename.c_str(), "r+b");
+        fseek(file, offset, SEEK_SET);
+        fputc(old, file);
+        fclose(file);
+        return ok;
+    };
+
+    // header of 24 bytes, then max_iter and time_limit before the verbose flag
+    const long verbose = 24 + 4 + 8;
+    ASSERT_TRUE(load_with(verbose, 1));
+    ASSERT_FALSE(load_with(verbose, 2));
+
+    // the tag of direct_solve_method follows 18 floats, two flags and two integers after that
+    const long method = verbose + 1 + 13 * 8 + 1 + 4 + 5 * 8 + 4 + 1;
+    ASSERT_TRUE(load_with(method, 1));
+    ASSERT_FALSE(load_with(method, 9));
+}
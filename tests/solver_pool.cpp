@@ -0,0 +1,106 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "qp_fixture.hpp"
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+class SolverPoolTest : public QPTest
+{
+  protected:
+    SolverPoolTest()
+    {
+        settings.verbose = false;
+        settings.presolve_enable = false;
+    }
+};
+
+TEST_F(SolverPoolTest, RecyclesSameStructure)
+{
+    SolverPool<double> pool(settings);
+
+    DefaultSolver<double> solver1 = pool.acquire(P, c, A, b, cones);
+    solver1.solve();
+    ASSERT_EQ(solver1.timings().symbolic_count, 1u);
+    pool.release(std::move(solver1));
+    ASSERT_EQ(pool.idle(), 1u);
+
+    // same structure, new values
+    SparseMatrix<double> P2 = P * 2.;
+    Vector<double, 2> c2 = { 1., -1. };
+    DefaultSolver<double> solver2 = pool.acquire(P2, c2, A, b, cones);
+    ASSERT_EQ(pool.idle(), 0u);
+    ASSERT_EQ(solver2.timings().symbolic_count, 1u);
+    solver2.solve();
+
+    DefaultSolver<double> fresh(P2, c2, A, b, cones, settings);
+    fresh.solve();
+    ASSERT_EQ(solver2.solution().status, SolverStatus::Solved);
+    ASSERT_TRUE(solver2.solution().x.isApprox(fresh.solution().x, 1e-8));
+    pool.release(std::move(solver2));
+
+    // different cones give a new solver
+    vector<SupportedConeT<double>> cones2 = { NonnegativeConeT<double>(6) };
+    DefaultSolver<double> solver3 = pool.acquire(P, c, A, b, cones2);
+    ASSERT_EQ(pool.idle(), 1u);
+    ASSERT_EQ(solver3.timings().symbolic_count, 1u);
+    pool.release(std::move(solver3));
+    ASSERT_EQ(pool.idle(), 2u);
+}
+
+TEST_F(SolverPoolTest, MaxIdleAndForeignSolvers)
+{
+    SolverPool<double> pool(settings, 1);
+
+    DefaultSolver<double> solver1 = pool.acquire(P, c, A, b, cones);
+    DefaultSolver<double> solver2 = pool.acquire(P, c, A, b, cones);
+    pool.release(std::move(solver1));
+    pool.release(std::move(solver2));
+    ASSERT_EQ(pool.idle(), 1u);
+
+    // solvers not handed out by the pool are freed on release
+    DefaultSolver<double> solver3(P, c, A, b, cones, settings);
+    pool.release(std::move(solver3));
+    ASSERT_EQ(pool.idle(), 1u);
+
+    // also those of a pool already freed, whose memory a newer pool may reuse
+    DefaultSolver<double> orphan = [&] {
+        SolverPool<double> old_pool(settings);
+        return old_pool.acquire(P, c, A, b, cones);
+    }();
+    SolverPool<double> new_pool(settings);
+    new_pool.release(std::move(orphan));
+    ASSERT_EQ(new_pool.idle(), 0u);
+}
+
+TEST_F(SolverPoolTest, RejectsBadDataFromC)
+{
+    RustObjectHandle pool = clarabel_SolverPool_f64_new(&settings, 0);
+    CscMatrix32<double> p(P.rows(), P.cols(), P.outerIndexPtr(), P.innerIndexPtr(), P.valuePtr());
+    CscMatrix32<double> a(A.rows(), A.cols(), A.outerIndexPtr(), A.innerIndexPtr(), A.valuePtr());
+
+    RustObjectHandle solver = clarabel_SolverPool_f64_acquire_i32(pool, &p, c.data(), &a, b.data(), cones.size(), cones.data());
+    ASSERT_NE(solver, nullptr);
+    clarabel_SolverPool_f64_release(pool, solver);
+    ASSERT_EQ(clarabel_SolverPool_f64_idle_count(pool), 1u);
+
+    // a missing b is rejected on the recycle path as on the build path, and the idle solver is kept
+    ASSERT_EQ(clarabel_SolverPool_f64_acquire_i32(pool, &p, c.data(), &a, nullptr, cones.size(), cones.data()), nullptr);
+    ASSERT_EQ(clarabel_SolverPool_f64_idle_count(pool), 1u);
+
+    // as are P and A with different numbers of columns
+    CscMatrix32<double> p_wide(P.rows(), P.cols() + 1, P.outerIndexPtr(), P.innerIndexPtr(), P.valuePtr());
+    ASSERT_EQ(clarabel_SolverPool_f64_acquire_i32(pool, &p_wide, c.data(), &a, b.data(), cones.size(), cones.data()),
+              nullptr);
+
+    solver = clarabel_SolverPool_f64_acquire_i32(pool, &p, c.data(), &a, b.data(), cones.size(), cones.data());
+    ASSERT_NE(solver, nullptr);
+    ASSERT_EQ(clarabel_SolverPool_f64_idle_count(pool), 0u);
+    clarabel_DefaultSolver_f64_free(solver);
+    clarabel_SolverPool_f64_free(pool);
+}
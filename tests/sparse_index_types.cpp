@@ -0,0 +1,148 @@
+#include <clarabel.hpp>
+#include <Eigen/Eigen>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "qp_fixture.hpp"
+
+using namespace std;
+using namespace clarabel;
+using namespace Eigen;
+
+class SparseIndexTypesTest : public QPTest
+{
+  protected:
+    SparseIndexTypesTest()
+    {
+        settings.presolve_enable = false;
+    }
+};
+
+TEST_F(SparseIndexTypesTest, Int64Indices)
+{
+    SparseMatrix<double, ColMajor, int64_t> P64 = P;
+    SparseMatrix<double, ColMajor, int64_t> A64 = A;
+    P64.makeCompressed();
+    A64.makeCompressed();
+
+    DefaultSolver<double> solver(P64, c, A64, b, cones, settings);
+    solver.solve();
+
+    DefaultSolution<double> solution = solver.solution();
+    ASSERT_EQ(solution.status, SolverStatus::Solved);
+
+    Vector2d ref_solution{ 0.3, 0.7 };
+    ASSERT_TRUE(solution.x.isApprox(ref_solution, 1e-6));
+}
+
+TEST_F(SparseIndexTypesTest, Int16Indices)
+{
+    // Narrow index types are widened into temporary copies
+    SparseMatrix<double, ColMajor, int16_t> P16 = P;
+    SparseMatrix<double, ColMajor, int16_t> A16 = A;
+    P16.makeCompressed();
+    A16.makeCompressed();
+
+    DefaultSolver<double> solver(P16, c, A16, b, cones, settings);
+    solver.solve();
+
+    DefaultSolution<double> solution = solver.solution();
+    ASSERT_EQ(solution.status, SolverStatus::Solved);
+
+    Vector2d ref_solution{ 0.3, 0.7 };
+    ASSERT_TRUE(solution.x.isApprox(ref_solution, 1e-6));
+}
+
+TEST_F(SparseIndexTypesTest, Int64UpdateMatrices)
+{
+    DefaultSolver<double> solver1(P, c, A, b, cones, settings);
+    solver1.solve();
+
+    SparseMatrix<double, ColMajor, int64_t> P64 = P;
+    SparseMatrix<double, ColMajor, int64_t> A64 = A;
+    P64.makeCompressed();
+    A64.makeCompressed();
+    P64.valuePtr()[0] = 10.;
+    A64.valuePtr()[0] = -2.;
+
+    // revised original solver
+    solver1.update_P(P64);
+    solver1.update_A(A64);
+    solver1.solve();
+
+    // new solver
+    DefaultSolver<double> solver2(P64, c, A64, b, cones, settings);
+    solver2.solve();
+
+    auto diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+}
+
+TEST_F(SparseIndexTypesTest, Int32UpdateMatrices)
+{
+    // Eigen's default 32-bit indices are passed to Rust as is, also for updates
+    SparseMatrix<double, ColMajor, int64_t> P64 = P;
+    SparseMatrix<double, ColMajor, int64_t> A64 = A;
+    P64.makeCompressed();
+    A64.makeCompressed();
+
+    auto solver1 = DefaultSolver<double>::with_problem_data(P64, c, A64, b, cones, settings);
+    solver1.solve();
+
+    SparseMatrix<double> P2 = P;
+    SparseMatrix<double> A2 = A;
+    P2.valuePtr()[0] = 10.;
+    A2.valuePtr()[0] = -2.;
+
+    // revised original solver
+    solver1.update_P(P2);
+    solver1.update_A(A2);
+    solver1.solve();
+
+    // new solver
+    DefaultSolver<double> solver2(P2, c, A2, b, cones, settings);
+    solver2.solve();
+    ASSERT_EQ(solver2.solution().status, SolverStatus::Solved);
+
+    VectorXd diff = solver1.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+
+    // the copy kept for cloning holds the updated values
+    DefaultSolver<double> solver3 = solver1.clone();
+    solver3.solve();
+    diff = solver3.solution().x - solver2.solution().x;
+    ASSERT_NEAR(diff.norm(), 0.0, 1e-6);
+}
+
+TEST_F(SparseIndexTypesTest, StructureHash)
+{
+    SparseMatrix<double, ColMajor, int64_t> P64 = P;
+    SparseMatrix<double, ColMajor, int64_t> A64 = A;
+    P64.makeCompressed();
+    A64.makeCompressed();
+
+    // the same for every index type
+    uint64_t hash = structure_hash(P, A, cones);
+    ASSERT_EQ(hash, structure_hash(P64, A64, cones));
+
+    // numeric values are ignored
+    SparseMatrix<double> P2 = P;
+    P2.valuePtr()[0] = 10.;
+    ASSERT_EQ(hash, structure_hash(P2, A, cones));
+    ASSERT_TRUE(same_pattern(P, P2));
+
+    // the pattern and the cones are not
+    SparseMatrix<double> P3 = P;
+    P3.coeffRef(0, 1) = 0.;
+    P3.prune(0.);
+    ASSERT_FALSE(same_pattern(P, P3));
+    ASSERT_NE(hash, structure_hash(P3, A, cones));
+
+    vector<SupportedConeT<double>> cones2 = {
+        NonnegativeConeT<double>(2),
+        NonnegativeConeT<double>(4)
+    };
+    ASSERT_NE(hash, structure_hash(P, A, cones2));
+}